@@ -37,6 +37,11 @@ public:
   /// initialize references after read
   virtual bool setReferences(const ICollectionProvider* collectionProvider) = 0;
 
+  /// defer initializing the references after read until they are first
+  /// accessed. Returns false if this is not supported, in which case
+  /// setReferences has to be called instead
+  virtual bool deferReferences(const ICollectionProvider* collectionProvider) = 0;
+
   /// set collection ID
   virtual void setID(uint32_t id) = 0;
 
@@ -1,15 +1,23 @@
 #ifndef PODIO_COLLECTIONIDTABLE_H
 #define PODIO_COLLECTIONIDTABLE_H
 
+#include "podio/utilities/StringKeyMap.h"
+
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace podio {
 
+/// Mapping between collection names and collection IDs.
+///
+/// Lookups in both directions go through hash indexes and only take a shared
+/// lock, so that concurrent lookups from several threads do not block each
+/// other. Only adding new names takes an exclusive lock.
 class CollectionIDTable {
 
 public:
@@ -62,9 +70,14 @@ public:
   }
 
 private:
+  /// (Re)build the hash indexes from the ids and names
+  void buildIndex();
+
   std::vector<uint32_t> m_collectionIDs{};
   std::vector<std::string> m_names{};
-  mutable std::unique_ptr<std::mutex> m_mutex{std::make_unique<std::mutex>()};
+  std::unordered_map<uint32_t, size_t> m_idIndex{}; ///< collection ID -> index into m_names
+  podio::StringKeyMap<size_t> m_nameIndex{};         ///< name -> index into m_collectionIDs
+  mutable std::unique_ptr<std::shared_mutex> m_mutex{std::make_unique<std::shared_mutex>()};
 };
 
 } // namespace podio
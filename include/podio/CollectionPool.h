@@ -0,0 +1,84 @@
+#ifndef PODIO_COLLECTIONPOOL_H
+#define PODIO_COLLECTIONPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+namespace podio {
+
+/// Process wide pool for recycling the (I/O) buffers of collections.
+///
+/// Collections and the buffers that are created by the CollectionBufferFactory
+/// get their data, ObjectID and vector member buffers from this pool and hand
+/// them back when they are destroyed. The returned buffers are cleared but keep
+/// their capacity, such that an event loop that repeatedly creates or reads
+/// collections of similar sizes reaches a steady state in which these buffers
+/// are no longer allocated.
+///
+/// Recycling is opt-in and has to be enabled via enable(). As long as it is not
+/// enabled acquire() simply creates a new buffer and release() deletes the
+/// passed buffer. The number of buffers that are kept per buffer type is
+/// limited (see setMaxBuffersPerType()), buffers that are released beyond that
+/// are deleted.
+///
+/// All functions can be called concurrently from several threads.
+///
+/// @note Collections that have been read usually release the contents of their
+/// data buffer after unpacking to save memory. With recycling enabled they keep
+/// the capacity of that buffer instead, trading memory for fewer allocations.
+class CollectionPool {
+public:
+  CollectionPool() = delete;
+
+  /// Enable (or disable) recycling of buffers. Disabling recycling also
+  /// releases all currently pooled buffers
+  static void enable(bool enabled = true);
+
+  /// Check whether recycling is enabled
+  static bool isEnabled();
+
+  /// Set the maximum number of buffers that are kept per buffer type
+  static void setMaxBuffersPerType(size_t maxBuffers);
+
+  /// Delete all currently pooled buffers
+  static void clear();
+
+  /// Get the total number of buffers that are currently pooled
+  static size_t size();
+
+  /// Get a (cleared) buffer from the pool or a new one if none is available
+  template <typename T>
+  static std::unique_ptr<std::vector<T>> acquire() {
+    if (auto* buffer = acquireImpl(typeid(std::vector<T>))) {
+      return std::unique_ptr<std::vector<T>>(static_cast<std::vector<T>*>(buffer));
+    }
+    return std::make_unique<std::vector<T>>();
+  }
+
+  /// Hand a buffer back to the pool. The buffer is cleared, but keeps its
+  /// capacity. If recycling is not enabled the buffer is simply deleted
+  template <typename T>
+  static void release(std::unique_ptr<std::vector<T>>&& buffer) {
+    if (!buffer || !isEnabled()) {
+      buffer.reset();
+      return;
+    }
+    buffer->clear();
+    releaseImpl(typeid(std::vector<T>), buffer.release(),
+                [](void* ptr) { delete static_cast<std::vector<T>*>(ptr); });
+  }
+
+private:
+  using DeleterT = void (*)(void*);
+
+  /// Get a pooled buffer of the given type or a nullptr if none is available
+  static void* acquireImpl(std::type_index type);
+  /// Put a buffer into the pool or delete it if the pool is full or disabled
+  static void releaseImpl(std::type_index type, void* buffer, DeleterT deleter);
+};
+
+} // namespace podio
+
+#endif // PODIO_COLLECTIONPOOL_H
@@ -0,0 +1,157 @@
+#ifndef PODIO_CONCURRENTREADER_H
+#define PODIO_CONCURRENTREADER_H
+
+#include "podio/FrameCategories.h"
+#include "podio/Reader.h"
+#include "podio/podioVersion.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace podio {
+
+/// Reader that can be used to read Frames from several threads concurrently.
+///
+/// Internally this keeps a pool of Readers that have been opened on the same
+/// file(s). Each call to readFrame borrows one of them for the duration of the
+/// call, such that reading on different threads happens on independent
+/// backend handles. New Readers are only opened when all existing ones are in
+/// use, up to a configurable maximum. All of them are opened via
+/// Reader::openShared from the Reader that is passed on construction, i.e. the
+/// metadata (e.g. collection information, collection ID tables and datamodel
+/// definitions) is read only once and shared between all of them.
+///
+/// @note For the ROOT based backends ROOT::EnableThreadSafety() has to be
+/// called before reading concurrently.
+class ConcurrentReader {
+public:
+  /// Create a reader for the passed files
+  ///
+  /// @param filenames  The files to read from. The Reader from which all
+  ///                   others are opened is created via makeReader
+  /// @param maxReaders The maximum number of Readers to open. Defaults to the
+  ///                   number of threads that the hardware supports
+  ConcurrentReader(const std::vector<std::string>& filenames, size_t maxReaders = 0);
+
+  /// Create a reader from an already opened Reader
+  ///
+  /// @param reader     The Reader from which all Readers that are used for
+  ///                   reading are opened. It is not used for reading itself
+  /// @param maxReaders The maximum number of Readers to open. Defaults to the
+  ///                   number of threads that the hardware supports
+  ConcurrentReader(podio::Reader reader, size_t maxReaders = 0);
+
+  ConcurrentReader(const ConcurrentReader&) = delete;
+  ConcurrentReader& operator=(const ConcurrentReader&) = delete;
+  ConcurrentReader(ConcurrentReader&&) = delete;
+  ConcurrentReader& operator=(ConcurrentReader&&) = delete;
+  ~ConcurrentReader() = default;
+
+  /// Read a specific frame for a given category. Can be called concurrently
+  /// from several threads
+  ///
+  /// @param name  The category name for which to read the next entry
+  /// @param index The entry number to read
+  /// @param collsToRead (optional) the collection names that should be read. If
+  ///             not provided (or empty) all collections will be read
+  ///
+  /// @returns A fully constructed Frame with the contents read from file
+  ///
+  /// @throws std::runtime_error in case the category is not available or in
+  ///         case the specified entry is not available
+  podio::Frame readFrame(std::string_view name, size_t index, const std::vector<std::string>& collsToRead = {});
+
+  /// Read a specific frame of the "events" category. Can be called
+  /// concurrently from several threads
+  ///
+  /// @param index The event number to read
+  /// @param collsToRead (optional) the collection names that should be read. If
+  ///             not provided (or empty) all collections will be read
+  ///
+  /// @returns A fully constructed Frame with the contents read from file
+  ///
+  /// @throws std::runtime_error in case the desired event is not available
+  podio::Frame readEvent(size_t index, const std::vector<std::string>& collsToRead = {}) {
+    return readFrame(podio::Category::Event, index, collsToRead);
+  }
+
+  /// Get the number of entries for the given name
+  ///
+  /// @param name The name of the category
+  ///
+  /// @returns The number of entries that are available for the category
+  size_t getEntries(std::string_view name) const;
+
+  /// Get the number of events
+  ///
+  /// @returns The number of entries that are available for the category
+  size_t getEvents() const {
+    return getEntries(podio::Category::Event);
+  }
+
+  /// Get the build version of podio that has been used to write the file(s)
+  podio::version::Version currentFileVersion() const {
+    return m_reader.currentFileVersion();
+  }
+
+  /// Get the (build) version of a datamodel that has been used to write the
+  /// file(s)
+  ///
+  /// @param name The name of the datamodel
+  ///
+  /// @returns The (build) version of the datamodel if available or an empty
+  ///          optional
+  std::optional<podio::version::Version> currentFileVersion(std::string_view name) const {
+    return m_reader.currentFileVersion(name);
+  }
+
+  /// Get the names of all the available Frame categories in the file(s).
+  std::vector<std::string_view> getAvailableCategories() const {
+    return m_reader.getAvailableCategories();
+  }
+
+  /// Get the datamodel definition for the given name
+  ///
+  /// @param name The name of the datamodel
+  ///
+  /// @returns The high level definition of the datamodel in JSON format
+  const std::string_view getDatamodelDefinition(std::string_view name) const {
+    return m_reader.getDatamodelDefinition(name);
+  }
+
+  /// Get all names of the datamodels that are available from this reader
+  std::vector<std::string> getAvailableDatamodels() const {
+    return m_reader.getAvailableDatamodels();
+  }
+
+  /// Get the number of Readers that have been opened so far
+  size_t getNReaders() const;
+
+private:
+  /// Borrow a Reader from the pool, opening a new one if necessary and allowed
+  std::unique_ptr<podio::Reader> acquireReader();
+
+  /// Put a Reader back into the pool
+  void releaseReader(std::unique_ptr<podio::Reader> reader);
+
+  podio::Reader m_reader;                                       ///< The Reader all others are opened from
+  std::mutex m_openMtx{};                                       ///< The mutex guarding opening Readers
+  size_t m_maxReaders;                                          ///< The maximum number of Readers
+  size_t m_nReaders{0};                                         ///< The number of opened Readers
+  std::vector<std::unique_ptr<podio::Reader>> m_idleReaders{};  ///< The Readers not in use
+  mutable std::mutex m_poolMtx{};                               ///< The mutex guarding the pool
+  std::condition_variable m_poolCond{};                         ///< For waiting on idle Readers
+  std::map<std::string, size_t, std::less<>> m_entries{};       ///< The number of entries per category
+};
+
+} // namespace podio
+
+#endif // PODIO_CONCURRENTREADER_H
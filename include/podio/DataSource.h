@@ -141,6 +141,10 @@ private:
   /// Active collections
   std::vector<unsigned int> m_activeCollections = {};
 
+  /// Podio reader used for probing the input, the readers of the slots share
+  /// its metadata
+  std::unique_ptr<podio::Reader> m_probingReader = nullptr;
+
   /// Root podio readers
   std::vector<std::unique_ptr<podio::Reader>> m_podioReaders = {};
 
@@ -6,17 +6,25 @@
 #include "podio/FrameCategories.h" // mainly for convenience
 #include "podio/GenericParameters.h"
 #include "podio/ICollectionProvider.h"
+#include "podio/MemoryResource.h"
 #include "podio/SchemaEvolution.h"
+#include "podio/utilities/StringKeyMap.h"
 #include "podio/utilities/TypeHelpers.h"
 
+#include <algorithm>
+#include <atomic>
 #include <concepts>
+#include <exception>
+#include <functional>
 #include <initializer_list>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -72,6 +80,60 @@ namespace detail {
     }
   };
   static_assert(FrameDataType<EmptyFrameData>, "EmptyFrameData should match FrameDataType concept");
+
+  /// Run all passed tasks concurrently on (at most) as many threads as the
+  /// hardware supports and wait for all of them to finish.
+  ///
+  /// If any of the tasks throws an exception, the first one will be re-thrown
+  /// once all threads have finished
+  inline void runConcurrently(const std::vector<std::function<void()>>& tasks) {
+    const auto nThreads =
+        std::min<size_t>(tasks.size(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+    if (nThreads <= 1) {
+      for (const auto& task : tasks) {
+        task();
+      }
+      return;
+    }
+
+    std::atomic<size_t> nextTask{0};
+    std::exception_ptr firstException{nullptr};
+    std::mutex exceptionMtx{};
+    const auto worker = [&]() {
+      for (auto i = nextTask++; i < tasks.size(); i = nextTask++) {
+        try {
+          tasks[i]();
+        } catch (...) {
+          std::lock_guard lock{exceptionMtx};
+          if (!firstException) {
+            firstException = std::current_exception();
+          }
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+    for (size_t i = 0; i < nThreads - 1; ++i) {
+      threads.emplace_back(worker);
+    }
+    // The calling thread also does some of the work
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (firstException) {
+      std::rethrow_exception(firstException);
+    }
+  }
+
+  /// Run all passed tasks sequentially on the calling thread
+  inline void runSequentially(const std::vector<std::function<void()>>& tasks) {
+    for (const auto& task : tasks) {
+      task();
+    }
+  }
 } // namespace detail
 
 template <FrameDataType FrameData>
@@ -85,17 +147,28 @@ std::optional<podio::CollectionReadBuffers> unpack(FrameData* data, const std::s
 /// It is possible to store collections as well as parameters / meta data in a
 /// Frame and all I/O facilities of podio operate on Frames.
 class Frame {
+public:
+  /// The type of the executors that can be used to unpack collections. An
+  /// executor has to run all the passed tasks (in any order and potentially
+  /// concurrently) and must only return once all of them have finished.
+  using Executor = std::function<void(const std::vector<std::function<void()>>&)>;
+
+private:
   /// Internal abstract interface for the type-erased implementation of the
   /// Frame class
   struct FrameConcept {
     virtual ~FrameConcept() = default;
     virtual const podio::CollectionBase* get(const std::string& name) const = 0;
     virtual const podio::CollectionBase* put(std::unique_ptr<podio::CollectionBase> coll, const std::string& name) = 0;
+    virtual void prefetch(const std::vector<std::string>& names, const Executor& executor) const = 0;
+    virtual void setLazyRelations(bool lazy) = 0;
     virtual podio::GenericParameters& parameters() = 0;
     virtual const podio::GenericParameters& parameters() const = 0;
 
     virtual std::vector<std::string> availableCollections() const = 0;
 
+    virtual std::pmr::memory_resource* memoryResource() const = 0;
+
     // Writing interface. Need this to be able to store all necessary information
     // TODO: Figure out whether this can be "hidden" somehow
     virtual podio::CollectionIDTable getIDTable() const = 0;
@@ -106,7 +179,7 @@ class Frame {
   template <typename FrameDataT>
   struct FrameModel final : FrameConcept, public ICollectionProvider {
 
-    FrameModel(std::unique_ptr<FrameDataT> data);
+    FrameModel(std::unique_ptr<FrameDataT> data, std::unique_ptr<std::pmr::memory_resource> resource = nullptr);
     ~FrameModel() override = default;
     FrameModel(const FrameModel&) = delete;
     FrameModel& operator=(const FrameModel&) = delete;
@@ -122,6 +195,16 @@ class Frame {
     /// a nullptr
     const podio::CollectionBase* put(std::unique_ptr<CollectionBase> coll, const std::string& name) final;
 
+    /// Unpack the passed collections and all the collections they depend on
+    /// using the passed executor
+    void prefetch(const std::vector<std::string>& names, const Executor& executor) const final;
+
+    /// Switch between resolving the relations of unpacked collections directly
+    /// or only on their first access
+    void setLazyRelations(bool lazy) final {
+      m_lazyRelations = lazy;
+    }
+
     /// Get a reference to the internally used GenericParameters
     podio::GenericParameters& parameters() override {
       return *m_parameters;
@@ -140,11 +223,31 @@ class Frame {
 
     std::vector<std::string> availableCollections() const override;
 
+    std::pmr::memory_resource* memoryResource() const override {
+      return m_resource.get();
+    }
+
   private:
     podio::CollectionBase* doGet(const std::string& name, bool setReferences = true) const;
 
+    /// Get the buffers for a collection from the raw data and turn them into a
+    /// (prepared) collection. Returns a nullptr if the collection is not
+    /// available in the raw data.
+    std::unique_ptr<podio::CollectionBase> unpackCollection(const std::string& name) const;
+
+    /// Get the slot of a collection that is known from the raw data. Returns a
+    /// nullptr for all other collections
+    std::atomic<podio::CollectionBase*>* slot(const std::string& name) const;
+
+    /// Make a collection that has been placed into the internal map available
+    /// via its slot (if it has one). Has to be called with m_mapMtx held
+    void publish(const std::string& name, podio::CollectionBase* coll) const;
+
     using CollectionMapT = std::unordered_map<std::string, std::unique_ptr<podio::CollectionBase>>;
 
+    /// The memory resource for the collections of this frame. Declared first
+    /// to make sure that it outlives all collections
+    std::unique_ptr<std::pmr::memory_resource> m_resource{nullptr};
     mutable CollectionMapT m_collections{};                 ///< The internal map for storing unpacked collections
     mutable std::unique_ptr<std::mutex> m_mapMtx{nullptr};  ///< The mutex for guarding the internal collection map
     std::unique_ptr<FrameDataT> m_data{nullptr};            ///< The raw data read from file
@@ -152,7 +255,14 @@ class Frame {
     podio::CollectionIDTable m_idTable{};                   ///< The collection ID table
     std::unique_ptr<podio::GenericParameters> m_parameters{nullptr}; ///< The generic parameter store for this frame
     mutable std::set<uint32_t> m_retrievedIDs{}; ///< The IDs of the collections that we have already read (but not yet
-                                                 ///< put into the map)
+                                                 ///< put into the map). Guarded by m_mapMtx
+    /// One slot for each collection that is known from the raw data, which
+    /// holds the collection once it is in the internal map. Makes it possible
+    /// to get these collections without locking
+    std::unique_ptr<std::atomic<podio::CollectionBase*>[]> m_slots{nullptr};
+    podio::StringKeyMap<size_t> m_slotIndex{};         ///< The slot index for each known collection name
+    std::unordered_map<uint32_t, size_t> m_idSlots{}; ///< The slot index for each known collection ID
+    bool m_lazyRelations{false}; ///< Whether relations of unpacked collections are resolved on first access
   };
 
   std::unique_ptr<FrameConcept> m_self; ///< The internal concept pointer through which all the work is done
@@ -172,6 +282,35 @@ public:
   template <FrameDataType FrameData>
   Frame(std::unique_ptr<FrameData>);
 
+  /// Empty Frame constructor for a Frame that owns a monotonic memory resource.
+  ///
+  /// Collections that are created while a MemoryResourceScope for the
+  /// resource of this Frame (see getMemoryResource()) is active allocate their
+  /// objects from it. Such collections have to be put into this Frame.
+  ///
+  /// @param upstream The resource from which the monotonic resource obtains
+  ///                 its memory. Uses the default resource if this is a
+  ///                 nullptr
+  explicit Frame(std::pmr::memory_resource* upstream);
+
+  /// Frame constructor from (almost) arbitrary raw data for a Frame that owns
+  /// a monotonic memory resource.
+  ///
+  /// All collections that are unpacked from the raw data allocate their
+  /// objects from the resource, which releases all its memory at once when the
+  /// Frame is destroyed.
+  ///
+  /// @tparam FrameData Arbitrary data container that provides access to the
+  ///                   collection buffers as well as the metadata, when
+  ///                   requested by the Frame.
+  /// @param upstream   The resource from which the monotonic resource obtains
+  ///                   its memory. Uses the default resource if this is a
+  ///                   nullptr
+  ///
+  /// @throws std::invalid_argument if the passed pointer is a nullptr.
+  template <FrameDataType FrameData>
+  Frame(std::unique_ptr<FrameData>, std::pmr::memory_resource* upstream);
+
 #ifdef PODIO_ROOT_OLDER_6_36
   /// Frame constructor from (almost) arbitrary raw data.
   ///
@@ -241,6 +380,50 @@ public:
   template <CollectionRValueType CollT>
   const CollT& put(CollT&& coll, const std::string& name);
 
+  /// Unpack several collections from the raw data in one go.
+  ///
+  /// Unpacking, including schema evolution, happens independently for all
+  /// collections and is distributed as separate tasks to the passed executor.
+  /// All collections that are referenced by the requested collections (e.g.
+  /// via relations) are unpacked as well, such that resolving the references
+  /// can also happen concurrently once all collections are available.
+  /// Collections that have already been unpacked or that are not available are
+  /// ignored.
+  ///
+  /// @param names    The names of the collections that should be unpacked
+  /// @param executor The executor that runs the unpacking tasks. By default
+  ///                 the tasks are run on as many threads as the hardware
+  ///                 supports.
+  void prefetch(const std::vector<std::string>& names, const Executor& executor = detail::runConcurrently) const {
+    m_self->prefetch(names, executor);
+  }
+
+  /// Unpack all collections that are still available in the raw data.
+  ///
+  /// @param parallel Whether the collections should be unpacked concurrently
+  ///                 or sequentially on the calling thread
+  void unpackAll(bool parallel = true) const {
+    prefetch(getAvailableCollections(), parallel ? Executor{detail::runConcurrently} : Executor{detail::runSequentially});
+  }
+
+  /// Only resolve the relations of collections that are unpacked by get once
+  /// they are first accessed.
+  ///
+  /// By default getting a collection also unpacks all collections it refers
+  /// to (and all the collections these refer to, etc.). In lazy mode related
+  /// collections are only unpacked once a relation of an object is accessed
+  /// for the first time. This has to be set before getting collections from
+  /// the Frame. Collections that are unpacked via prefetch (or unpackAll)
+  /// always have their relations resolved directly.
+  ///
+  /// @note This only affects datatypes with relations, subset collections and
+  /// link collections are always resolved directly.
+  ///
+  /// @param lazy Whether relations should be resolved lazily
+  void setLazyRelations(bool lazy = true) {
+    m_self->setLazyRelations(lazy);
+  }
+
   /// (Destructively) move a collection into the Frame.
   ///
   /// @param coll The collection that should be moved into the Frame
@@ -338,6 +521,13 @@ public:
     return m_self->availableCollections();
   }
 
+  /// Get the memory resource that is owned by this Frame
+  ///
+  /// @returns The memory resource or a nullptr if the Frame does not own one
+  std::pmr::memory_resource* getMemoryResource() const {
+    return m_self->memoryResource();
+  }
+
   /// Get the name of the passed collection
   ///
   /// @param coll The collection for which the name should be obtained
@@ -395,6 +585,17 @@ template <FrameDataType FrameData>
 Frame::Frame(std::unique_ptr<FrameData> data) : m_self(std::make_unique<FrameModel<FrameData>>(std::move(data))) {
 }
 
+inline Frame::Frame(std::pmr::memory_resource* upstream) :
+    Frame(std::make_unique<detail::EmptyFrameData>(), upstream) {
+}
+
+template <FrameDataType FrameData>
+Frame::Frame(std::unique_ptr<FrameData> data, std::pmr::memory_resource* upstream) :
+    m_self(std::make_unique<FrameModel<FrameData>>(
+        std::move(data), std::make_unique<detail::SynchronizedMonotonicResource>(
+                             upstream ? upstream : std::pmr::get_default_resource()))) {
+}
+
 #ifdef PODIO_ROOT_OLDER_6_36
 template <RValueFrameDataType FrameData>
 Frame::Frame(FrameData&& data) : Frame(std::make_unique<FrameData>(std::move(data))) {
@@ -423,8 +624,9 @@ const CollT& Frame::put(CollT&& coll, const std::string& name) {
 }
 
 template <typename FrameDataT>
-Frame::FrameModel<FrameDataT>::FrameModel(std::unique_ptr<FrameDataT> data) :
-    m_mapMtx(std::make_unique<std::mutex>()), m_dataMtx(std::make_unique<std::mutex>()) {
+Frame::FrameModel<FrameDataT>::FrameModel(std::unique_ptr<FrameDataT> data,
+                                          std::unique_ptr<std::pmr::memory_resource> resource) :
+    m_resource(std::move(resource)), m_mapMtx(std::make_unique<std::mutex>()), m_dataMtx(std::make_unique<std::mutex>()) {
   if (!data) {
     throw std::invalid_argument(
         "FrameData is a nullptr. If you are reading from a file it may be corrupted or you may reading beyond the end "
@@ -433,6 +635,33 @@ Frame::FrameModel<FrameDataT>::FrameModel(std::unique_ptr<FrameDataT> data) :
   m_data = std::move(data);
   m_idTable = std::move(m_data->getIDTable());
   m_parameters = std::move(m_data->getParameters());
+
+  // The collections that are known at this point do not change any longer, so
+  // the slot indices can be used without locking
+  const auto& names = m_idTable.names();
+  const auto& ids = m_idTable.ids();
+  m_slots = std::make_unique<std::atomic<podio::CollectionBase*>[]>(names.size());
+  m_slotIndex.reserve(names.size());
+  m_idSlots.reserve(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    m_slotIndex.try_emplace(names[i], i);
+    m_idSlots.try_emplace(ids[i], i);
+  }
+}
+
+template <typename FrameDataT>
+std::atomic<podio::CollectionBase*>* Frame::FrameModel<FrameDataT>::slot(const std::string& name) const {
+  if (const auto it = m_slotIndex.find(name); it != m_slotIndex.end()) {
+    return &m_slots[it->second];
+  }
+  return nullptr;
+}
+
+template <typename FrameDataT>
+void Frame::FrameModel<FrameDataT>::publish(const std::string& name, podio::CollectionBase* coll) const {
+  if (auto* collSlot = slot(name)) {
+    collSlot->store(coll, std::memory_order_release);
+  }
 }
 
 template <typename FrameDataT>
@@ -442,6 +671,14 @@ const podio::CollectionBase* Frame::FrameModel<FrameDataT>::get(const std::strin
 
 template <typename FrameDataT>
 podio::CollectionBase* Frame::FrameModel<FrameDataT>::doGet(const std::string& name, bool setReferences) const {
+  // Collections that are known from the raw data can be obtained without
+  // locking once they have been published
+  if (const auto* collSlot = slot(name)) {
+    if (auto* coll = collSlot->load(std::memory_order_acquire)) {
+      return coll;
+    }
+  }
+
   {
     // First check whether the collection is in the map already
     //
@@ -456,53 +693,160 @@ podio::CollectionBase* Frame::FrameModel<FrameDataT>::doGet(const std::string& n
   podio::CollectionBase* retColl = nullptr;
 
   // Now try to get it from the raw data if we have the possibility
-  if (m_data) {
-    // Have the buffers in the outer scope here to hold the raw data lock as
-    // briefly as possible
-    std::optional<podio::CollectionReadBuffers> buffers;
+  if (auto coll = unpackCollection(name)) {
     {
-      std::lock_guard lock{*m_dataMtx};
-      buffers = unpack(m_data.get(), name);
+      std::lock_guard mapLock{*m_mapMtx};
+      auto [it, success] = m_collections.emplace(name, std::move(coll));
+      // TODO: Check success? Or simply assume that everything is fine at this point?
+      // TODO: Collision handling?
+      retColl = it->second.get();
+      publish(name, retColl);
+    }
+
+    if (setReferences && !(m_lazyRelations && retColl->deferReferences(this))) {
+      retColl->setReferences(this);
+    }
+  }
+
+  return retColl;
+}
+
+template <typename FrameDataT>
+std::unique_ptr<podio::CollectionBase>
+Frame::FrameModel<FrameDataT>::unpackCollection(const std::string& name) const {
+  if (!m_data) {
+    return nullptr;
+  }
+
+  // Have the buffers in the outer scope here to hold the raw data lock as
+  // briefly as possible
+  std::optional<podio::CollectionReadBuffers> buffers;
+  {
+    std::lock_guard lock{*m_dataMtx};
+    buffers = unpack(m_data.get(), name);
+  }
+  if (!buffers) {
+    return nullptr;
+  }
+
+  // Make the collection allocate its objects from our resource (if any)
+  podio::MemoryResourceScope resourceScope{m_resource ? m_resource.get() : podio::currentMemoryResource()};
+  std::unique_ptr<podio::CollectionBase> coll{nullptr};
+  // Subset collections do not need schema evolution (by definition)
+  if (buffers->data == nullptr) {
+    coll = buffers->createCollection(std::move(buffers.value()), true);
+  } else {
+    const auto version = buffers->schemaVersion;
+    const std::string collType{buffers->type};
+    auto evolvedBuffers =
+        podio::SchemaEvolution::instance().evolveBuffers(std::move(buffers.value()), version, collType);
+    coll = evolvedBuffers.createCollection(std::move(evolvedBuffers), false);
+  }
+
+  coll->prepareAfterRead();
+  coll->setID(m_idTable.collectionID(name).value());
+  return coll;
+}
+
+template <typename FrameDataT>
+void Frame::FrameModel<FrameDataT>::prefetch(const std::vector<std::string>& names, const Executor& executor) const {
+  if (!m_data) {
+    return;
+  }
+
+  // Unpacking happens in waves, where each wave consists of the collections
+  // that are referenced by the previous one, but have not yet been unpacked.
+  // Setting the references is deferred until all collections are available,
+  // such that it can happen concurrently without anything being unpacked
+  // implicitly in the process
+  std::set<std::string> seen{};
+  std::vector<std::string> toUnpack{};
+  {
+    std::lock_guard lock{*m_mapMtx};
+    for (const auto& name : names) {
+      if (!m_collections.contains(name) && seen.insert(name).second) {
+        toUnpack.push_back(name);
+      }
     }
-    if (buffers) {
-      std::unique_ptr<podio::CollectionBase> coll{nullptr};
-      // Subset collections do not need schema evolution (by definition)
-      if (buffers->data == nullptr) {
-        coll = buffers->createCollection(std::move(buffers.value()), true);
-      } else {
-        const auto version = buffers->schemaVersion;
-        const std::string collType{buffers->type};
-        auto evolvedBuffers =
-            podio::SchemaEvolution::instance().evolveBuffers(std::move(buffers.value()), version, collType);
-        coll = evolvedBuffers.createCollection(std::move(evolvedBuffers), false);
+  }
+
+  std::vector<std::pair<std::string, std::unique_ptr<podio::CollectionBase>>> unpacked{};
+  while (!toUnpack.empty()) {
+    std::vector<std::unique_ptr<podio::CollectionBase>> colls(toUnpack.size());
+    std::vector<std::function<void()>> tasks{};
+    tasks.reserve(toUnpack.size());
+    for (size_t i = 0; i < toUnpack.size(); ++i) {
+      tasks.emplace_back([this, &colls, &toUnpack, i]() { colls[i] = unpackCollection(toUnpack[i]); });
+    }
+    executor(tasks);
+
+    std::set<uint32_t> referencedIDs{};
+    for (size_t i = 0; i < toUnpack.size(); ++i) {
+      if (!colls[i]) {
+        continue;
       }
+      for (const auto& refs : *colls[i]->getBuffers().references) {
+        for (const auto& id : *refs) {
+          referencedIDs.insert(id.collectionID);
+        }
+      }
+      unpacked.emplace_back(std::move(toUnpack[i]), std::move(colls[i]));
+    }
 
-      coll->prepareAfterRead();
-      coll->setID(m_idTable.collectionID(name).value());
-      {
-        std::lock_guard mapLock{*m_mapMtx};
-        auto [it, success] = m_collections.emplace(name, std::move(coll));
-        // TODO: Check success? Or simply assume that everything is fine at this point?
-        // TODO: Collision handling?
-        retColl = it->second.get();
+    std::vector<std::string> nextWave{};
+    std::lock_guard lock{*m_mapMtx};
+    for (const auto id : referencedIDs) {
+      auto name = m_idTable.name(id);
+      if (name && !m_collections.contains(name.value()) && seen.insert(name.value()).second) {
+        nextWave.emplace_back(std::move(name.value()));
       }
+    }
+    toUnpack = std::move(nextWave);
+  }
 
-      if (setReferences) {
-        retColl->setReferences(this);
+  std::vector<podio::CollectionBase*> inserted{};
+  inserted.reserve(unpacked.size());
+  {
+    std::lock_guard lock{*m_mapMtx};
+    for (auto& [name, coll] : unpacked) {
+      const auto id = coll->getID();
+      if (auto [it, success] = m_collections.emplace(std::move(name), std::move(coll)); success) {
+        m_retrievedIDs.insert(id);
+        inserted.push_back(it->second.get());
+        publish(it->first, it->second.get());
       }
     }
   }
 
-  return retColl;
+  std::vector<std::function<void()>> tasks{};
+  tasks.reserve(inserted.size());
+  for (auto* coll : inserted) {
+    tasks.emplace_back([this, coll]() { coll->setReferences(this); });
+  }
+  executor(tasks);
 }
 
 template <typename FrameDataT>
 bool Frame::FrameModel<FrameDataT>::get(uint32_t collectionID, CollectionBase*& collection) const {
+  // Published collections have been prepared after reading, but their
+  // references might not have been set yet. Resolving relations to them only
+  // needs their objects, and their references are set by whoever unpacked them
+  if (const auto it = m_idSlots.find(collectionID); it != m_idSlots.end()) {
+    if (auto* coll = m_slots[it->second].load(std::memory_order_acquire)) {
+      collection = coll;
+      return true;
+    }
+  }
+
   const auto name = m_idTable.name(collectionID);
   if (!name) {
     return false;
   }
-  const auto& [_, inserted] = m_retrievedIDs.insert(collectionID);
+  bool inserted = false;
+  {
+    std::lock_guard lock{*m_mapMtx};
+    inserted = m_retrievedIDs.insert(collectionID).second;
+  }
 
   if (inserted) {
     auto coll = doGet(name.value());
@@ -533,6 +877,7 @@ const podio::CollectionBase* Frame::FrameModel<FrameDataT>::put(std::unique_ptr<
       // -> Check before we emplace it into the internal map to prevent possible
       //    collisions from collections that are potentially present from rawdata?
       it->second->setID(m_idTable.add(name));
+      publish(name, it->second.get());
       return it->second.get();
     } else {
       throw std::invalid_argument("An object with key " + name + " already exists in the frame");
@@ -1,9 +1,14 @@
 #ifndef PODIO_LINKNAVIGATOR_H
 #define PODIO_LINKNAVIGATOR_H
 
+#include "podio/detail/OrderKey.h"
+
+#include <algorithm>
 #include <concepts>
-#include <map>
-#include <tuple>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -27,6 +32,64 @@ namespace detail::links {
     }
   };
 
+  /// The linked objects for a whole range of objects in compressed sparse row
+  /// format, as returned by the batch lookups of the LinkNavigator
+  ///
+  /// The objects linked to the i-th object of the queried range are
+  /// objects[offsets[i]] to objects[offsets[i + 1]] (excluding the latter).
+  template <typename T>
+  struct LinkedObjects {
+    std::vector<size_t> offsets{0};           ///< The offsets into objects (one more than queried objects)
+    std::vector<WeightedObject<T>> objects{}; ///< The linked objects for all queried objects
+
+    /// The number of objects that have been queried
+    size_t size() const {
+      return offsets.size() - 1;
+    }
+
+    /// Get the linked objects for the i-th queried object
+    std::span<const WeightedObject<T>> operator[](size_t i) const {
+      return std::span(objects).subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    }
+  };
+
+  /// A flat lookup index from objects to the (weighted) objects they are linked
+  /// with. Objects are identified via their podio::detail::OrderKey, i.e. the
+  /// lookup is done on a sorted vector of these keys.
+  template <typename T>
+  class LinkIndex {
+  public:
+    LinkIndex() = default;
+
+    /// Build the index from (parallel) vectors of keys and linked objects
+    LinkIndex(std::vector<OrderKey>&& keys, std::vector<WeightedObject<T>>&& objects) {
+      // Sort a permutation to avoid moving around the (larger) handles while
+      // sorting. A stable sort keeps the order of the links for each key
+      auto perm = std::vector<size_t>(keys.size());
+      std::iota(perm.begin(), perm.end(), 0);
+      std::ranges::stable_sort(perm, [&keys](size_t i, size_t j) { return keys[i] < keys[j]; });
+
+      m_keys.reserve(keys.size());
+      m_objects.reserve(objects.size());
+      for (const auto i : perm) {
+        m_keys.emplace_back(keys[i]);
+        m_objects.emplace_back(std::move(objects[i]));
+      }
+    }
+
+    /// Get all the linked objects for the passed key
+    std::span<const WeightedObject<T>> find(OrderKey key) const {
+      const auto [begin, end] = std::ranges::equal_range(m_keys, key, [](const OrderKey& lhs, const OrderKey& rhs) {
+        return lhs < rhs;
+      });
+      return std::span(m_objects).subspan(std::distance(m_keys.begin(), begin), std::distance(begin, end));
+    }
+
+  private:
+    std::vector<OrderKey> m_keys{};             ///< The sorted keys
+    std::vector<WeightedObject<T>> m_objects{}; ///< The linked objects in the same order as the keys
+  };
+
   /// Simple struct tag for overload selection in LinkNavigator below
   struct [[deprecated("The tagged versions of getLinked are deprecated use getLinkedFrom instead")]] ReturnFromTag {};
   /// Simple struct tag for overload selection in LinkNavigator below
@@ -53,13 +116,13 @@ namespace detail::links {
 
 /// A helper class to more easily handle one-to-many links.
 ///
-/// Internally simply populates two maps in its constructor and then queries
-/// them to retrieve objects that are linked with another.
+/// Internally builds two flat lookup indices (one for each direction) in its
+/// constructor and then queries them to retrieve objects that are linked with
+/// another. Building the indices only involves a handful of allocations
+/// independent of the number of links.
 ///
-/// @note There are no guarantees on the order of the objects in these maps.
-/// Hence, there are also no guarantees on the order of the returned objects,
-/// even if there inherintly is an order to them in the underlying links
-/// collection.
+/// The objects that are linked with a given object are returned in the order
+/// of the corresponding links in the underlying link collection.
 template <typename LinkCollT>
 class LinkNavigator {
   using FromT = typename LinkCollT::from_type;
@@ -67,6 +130,8 @@ class LinkNavigator {
 
   template <typename T>
   using WeightedObject = detail::links::WeightedObject<T>;
+  template <typename T>
+  using LinkedObjects = detail::links::LinkedObjects<T>;
 
 public:
   /// Construct a navigator from an link collection
@@ -96,14 +161,32 @@ public:
   /// @returns A vector of all objects and their weights that have links with
   ///          the passed object
   std::vector<WeightedObject<FromT>> getLinkedFrom(const ToT& object) const {
-    const auto& [begin, end] = m_to2from.equal_range(object);
-    std::vector<WeightedObject<FromT>> result;
-    result.reserve(std::distance(begin, end));
+    const auto linked = getLinkedFromView(object);
+    return {linked.begin(), linked.end()};
+  }
 
-    for (auto it = begin; it != end; ++it) {
-      result.emplace_back(it->second);
-    }
-    return result;
+  /// Get all the *From* objects and weights that have links with the passed
+  /// object without copying them
+  ///
+  /// @param object The object that is labeled *To* in the link
+  ///
+  /// @returns A view of all objects and their weights that have links with the
+  ///          passed object. It is valid as long as this LinkNavigator is
+  std::span<const WeightedObject<FromT>> getLinkedFromView(const ToT& object) const {
+    return m_to2from.find(podio::detail::orderKeyOf(object));
+  }
+
+  /// Get the *From* objects and weights that have links with each of the
+  /// passed objects in one go
+  ///
+  /// @param objects A range of objects that are labeled *To* in the link, e.g.
+  ///                a whole collection
+  ///
+  /// @returns The linked objects of all passed objects in the same order as the
+  ///          passed objects
+  template <std::ranges::input_range RangeT>
+  LinkedObjects<FromT> getAllLinkedFrom(const RangeT& objects) const {
+    return getAllLinked(m_to2from, objects);
   }
 
   [[deprecated("Use getLinkedFrom instead")]]
@@ -157,14 +240,32 @@ public:
   /// @returns A vector of all objects and their weights that have links with
   ///          the passed object
   std::vector<WeightedObject<ToT>> getLinkedTo(const FromT& object) const {
-    const auto& [begin, end] = m_from2to.equal_range(object);
-    std::vector<WeightedObject<ToT>> result;
-    result.reserve(std::distance(begin, end));
+    const auto linked = getLinkedToView(object);
+    return {linked.begin(), linked.end()};
+  }
 
-    for (auto it = begin; it != end; ++it) {
-      result.emplace_back(it->second);
-    }
-    return result;
+  /// Get all the *To* objects and weights that have links with the passed
+  /// object without copying them
+  ///
+  /// @param object The object that is labeled *From* in the link
+  ///
+  /// @returns A view of all objects and their weights that have links with the
+  ///          passed object. It is valid as long as this LinkNavigator is
+  std::span<const WeightedObject<ToT>> getLinkedToView(const FromT& object) const {
+    return m_from2to.find(podio::detail::orderKeyOf(object));
+  }
+
+  /// Get the *To* objects and weights that have links with each of the passed
+  /// objects in one go
+  ///
+  /// @param objects A range of objects that are labeled *From* in the link,
+  ///                e.g. a whole collection
+  ///
+  /// @returns The linked objects of all passed objects in the same order as the
+  ///          passed objects
+  template <std::ranges::input_range RangeT>
+  LinkedObjects<ToT> getAllLinkedTo(const RangeT& objects) const {
+    return getAllLinked(m_from2to, objects);
   }
 
   [[deprecated("Use getLinkedTo instead")]]
@@ -203,16 +304,45 @@ public:
   }
 
 private:
-  std::multimap<FromT, WeightedObject<ToT>> m_from2to{}; ///< Map the from to the to objects
-  std::multimap<ToT, WeightedObject<FromT>> m_to2from{}; ///< Map the to to the from objects
+  /// Look up the linked objects for all passed objects in the passed index
+  template <typename T, typename RangeT>
+  static LinkedObjects<T> getAllLinked(const detail::links::LinkIndex<T>& index, const RangeT& objects) {
+    auto result = LinkedObjects<T>{};
+    if constexpr (std::ranges::sized_range<RangeT>) {
+      result.offsets.reserve(std::ranges::size(objects) + 1);
+    }
+    for (const auto& obj : objects) {
+      const auto linked = index.find(podio::detail::orderKeyOf(obj));
+      result.objects.insert(result.objects.end(), linked.begin(), linked.end());
+      result.offsets.emplace_back(result.objects.size());
+    }
+    return result;
+  }
+
+  detail::links::LinkIndex<ToT> m_from2to{};   ///< Lookup the to objects for a from object
+  detail::links::LinkIndex<FromT> m_to2from{}; ///< Lookup the from objects for a to object
 };
 
 template <typename LinkCollT>
 LinkNavigator<LinkCollT>::LinkNavigator(const LinkCollT& links) {
+  auto fromKeys = std::vector<podio::detail::OrderKey>{};
+  auto toKeys = std::vector<podio::detail::OrderKey>{};
+  auto toObjects = std::vector<WeightedObject<ToT>>{};
+  auto fromObjects = std::vector<WeightedObject<FromT>>{};
+  fromKeys.reserve(links.size());
+  toKeys.reserve(links.size());
+  toObjects.reserve(links.size());
+  fromObjects.reserve(links.size());
+
   for (const auto& [from, to, weight] : links) {
-    m_from2to.emplace(std::piecewise_construct, std::forward_as_tuple(from), std::forward_as_tuple(to, weight));
-    m_to2from.emplace(std::piecewise_construct, std::forward_as_tuple(to), std::forward_as_tuple(from, weight));
+    fromKeys.emplace_back(podio::detail::orderKeyOf(from));
+    toKeys.emplace_back(podio::detail::orderKeyOf(to));
+    toObjects.emplace_back(to, weight);
+    fromObjects.emplace_back(from, weight);
   }
+
+  m_from2to = detail::links::LinkIndex<ToT>(std::move(fromKeys), std::move(toObjects));
+  m_to2from = detail::links::LinkIndex<FromT>(std::move(toKeys), std::move(fromObjects));
 }
 
 } // namespace podio
@@ -0,0 +1,83 @@
+#ifndef PODIO_MEMORYRESOURCE_H
+#define PODIO_MEMORYRESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace podio {
+
+/// Get the memory resource from which collections that are created on the
+/// current thread allocate their objects.
+///
+/// @returns The resource that has been set by the innermost active
+///          MemoryResourceScope on this thread or a nullptr if there is none,
+///          in which case the default allocation is used
+std::pmr::memory_resource* currentMemoryResource();
+
+/// RAII helper to make collections that are created on the current thread
+/// allocate their objects from the passed memory resource.
+///
+/// The resource is used by all collections that are constructed on this thread
+/// while the scope is alive. It is used for the whole lifetime of these
+/// collections, i.e. it has to outlive them. Scopes can be nested, the previous
+/// resource is restored when a scope ends.
+///
+/// @note The objects of generated datatypes and the containers that keep
+/// track of them are allocated from the resource. The I/O buffers as well as
+/// the vectors holding the relations and vector members of the objects use
+/// the default allocation, since their types are shared with the I/O backends
+/// and the relation accessors.
+class MemoryResourceScope {
+public:
+  explicit MemoryResourceScope(std::pmr::memory_resource* resource);
+  ~MemoryResourceScope();
+
+  MemoryResourceScope(const MemoryResourceScope&) = delete;
+  MemoryResourceScope& operator=(const MemoryResourceScope&) = delete;
+  MemoryResourceScope(MemoryResourceScope&&) = delete;
+  MemoryResourceScope& operator=(MemoryResourceScope&&) = delete;
+
+private:
+  std::pmr::memory_resource* m_previous{nullptr}; ///< The resource that was active before
+};
+
+namespace detail {
+  /// Get the resource from which collections that are created on the current
+  /// thread allocate their objects, falling back to the default resource if
+  /// there is no active MemoryResourceScope
+  inline std::pmr::memory_resource* currentOrDefaultResource() {
+    auto* resource = currentMemoryResource();
+    return resource ? resource : std::pmr::get_default_resource();
+  }
+
+  /// A monotonic memory resource that can be used from several threads
+  /// concurrently. All memory is released at once when the resource is
+  /// destroyed.
+  class SynchronizedMonotonicResource final : public std::pmr::memory_resource {
+  public:
+    explicit SynchronizedMonotonicResource(std::pmr::memory_resource* upstream) : m_resource(upstream) {
+    }
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+      std::lock_guard lock{m_mtx};
+      return m_resource.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {
+      // Monotonic, only released on destruction
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    std::mutex m_mtx{};
+    std::pmr::monotonic_buffer_resource m_resource;
+  };
+} // namespace detail
+
+} // namespace podio
+
+#endif // PODIO_MEMORYRESOURCE_H
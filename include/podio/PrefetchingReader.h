@@ -0,0 +1,104 @@
+#ifndef PODIO_PREFETCHINGREADER_H
+#define PODIO_PREFETCHINGREADER_H
+
+#include "podio/FrameCategories.h"
+#include "podio/Reader.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace podio {
+
+/// Reader that reads (and optionally unpacks) the Frames of one category on a
+/// background thread, such that I/O can overlap with processing.
+///
+/// The background thread reads ahead up to a configurable number of Frames
+/// and keeps them in a queue from which they are handed out in the order in
+/// which they are stored in the file. The wrapped Reader is exclusively used
+/// by the background thread.
+///
+/// @note This class itself is not thread-safe, i.e. Frames should only be
+/// requested from one thread at a time.
+class PrefetchingReader {
+public:
+  /// Create a prefetching reader from a Reader
+  ///
+  /// @param reader      The Reader that should be used for reading. The
+  ///                    PrefetchingReader takes ownership
+  /// @param category    The category of Frames that should be read
+  /// @param depth       The maximum number of Frames that are read ahead
+  /// @param collsToRead (optional) the collection names that should be read.
+  ///                    If empty all collections will be read
+  /// @param unpack      Whether all collections should also be unpacked on the
+  ///                    background thread, instead of on first access
+  ///
+  /// @throws std::invalid_argument if depth is 0
+  PrefetchingReader(podio::Reader&& reader, std::string_view category = podio::Category::Event, size_t depth = 4,
+                    const std::vector<std::string>& collsToRead = {}, bool unpack = true);
+
+  PrefetchingReader(const PrefetchingReader&) = delete;
+  PrefetchingReader& operator=(const PrefetchingReader&) = delete;
+  PrefetchingReader(PrefetchingReader&&) = delete;
+  PrefetchingReader& operator=(PrefetchingReader&&) = delete;
+
+  /// Destructor that stops reading ahead and waits for the background thread
+  /// to finish
+  ~PrefetchingReader();
+
+  /// Get a future for the next Frame
+  ///
+  /// The future becomes ready once the Frame has been read. Any exception that
+  /// is thrown while reading the Frame is re-thrown from get() of the future.
+  ///
+  /// @returns A future holding the next Frame. If no more Frames are available
+  ///          the future will hold a std::runtime_error instead
+  std::future<podio::Frame> readNextFrameAsync();
+
+  /// Read the next Frame, waiting for it if it has not yet been read
+  ///
+  /// @returns The next Frame
+  ///
+  /// @throws std::runtime_error in case no more Frames are available or in case
+  ///         reading fails
+  podio::Frame readNextFrame() {
+    return readNextFrameAsync().get();
+  }
+
+  /// Get the number of entries of the category that is read
+  size_t getEntries() const {
+    return m_entries;
+  }
+
+  /// Get the category that is read
+  const std::string& getCategory() const {
+    return m_category;
+  }
+
+private:
+  /// The function that is run on the background thread
+  void readAhead();
+
+  podio::Reader m_reader;                          ///< The reader that is used on the background thread
+  std::string m_category;                          ///< The category that is read
+  std::vector<std::string> m_collsToRead;          ///< The collections that should be read
+  size_t m_depth;                                  ///< The maximum number of Frames that are read ahead
+  bool m_unpack;                                   ///< Whether Frames should be unpacked after reading
+  size_t m_entries;                                ///< The number of entries in the category
+  std::deque<std::future<podio::Frame>> m_queue{}; ///< The Frames that are (being) read ahead
+  bool m_finished{false};                          ///< Whether the background thread has finished
+  bool m_stop{false};                              ///< Whether the background thread should stop
+  std::mutex m_queueMtx{};                         ///< The mutex guarding the queue and the flags
+  std::condition_variable m_queueCond{};           ///< For signalling changes to the queue or the flags
+  std::thread m_readThread{};                      ///< The background thread
+};
+
+} // namespace podio
+
+#endif // PODIO_PREFETCHINGREADER_H
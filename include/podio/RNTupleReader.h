@@ -97,6 +97,15 @@ public:
   /// @returns The number of entries that are available for the category
   unsigned getEntries(std::string_view name) const;
 
+  /// Open another reader on the same file(s) that shares all the metadata of
+  /// this one, i.e. the file version, the datamodel definitions, the
+  /// collection information and the collection ID tables are not read again.
+  /// The returned reader has its own RNTuple readers and keeps track of its own
+  /// entries, so that it can be used on a different thread than this one.
+  ///
+  /// @returns A reader that is ready to read from the same file(s)
+  std::unique_ptr<RNTupleReader> openShared();
+
 private:
   /**
    * Initialize the given category by filling the maps with metadata information
@@ -104,6 +113,12 @@ private:
    */
   bool initCategory(std::string_view category);
 
+  /**
+   * Open the readers for all available categories in all files and count their
+   * entries
+   */
+  void openCategoryReaders();
+
   /**
    * Read and reconstruct the generic parameters of the Frame
    */
@@ -124,7 +139,8 @@ private:
   std::unordered_map<std::string_view, unsigned> m_totalEntries{};
 
   /// Map each category to the collections that have been written and are available
-  std::unordered_map<std::string_view, std::vector<podio::root_utils::CollectionWriteInfo>> m_collectionInfo{};
+  std::unordered_map<std::string_view, std::shared_ptr<const std::vector<podio::root_utils::CollectionWriteInfo>>>
+      m_collectionInfo{};
 
   std::unordered_map<std::string_view, std::shared_ptr<podio::CollectionIDTable>> m_idTables{};
 };
@@ -2,17 +2,24 @@
 #define PODIO_RNTUPLEWRITER_H
 
 #include "podio/Frame.h"
+#include "podio/WriterOptions.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 #include "podio/utilities/RootHelpers.h"
 #include "podio/utilities/StringKeyMap.h"
 
 #include "TFile.h"
 #include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleFillContext.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleWriter.hxx>
 #include <ROOT/RVersion.hxx>
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace podio {
@@ -22,10 +29,16 @@ namespace root_compat {
   using REntry = ROOT::Experimental::REntry;
   using RNTupleModel = ROOT::Experimental::RNTupleModel;
   using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
+  using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
+  using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
 #else
   using REntry = ROOT::REntry;
   using RNTupleModel = ROOT::RNTupleModel;
   using RNTupleWriter = ROOT::RNTupleWriter;
+  // Parallel writing has not been moved out of Experimental with the API
+  // stabilization
+  using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
+  using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
 #endif
 } // namespace root_compat
 
@@ -37,14 +50,34 @@ namespace root_compat {
 /// for reading.
 ///
 /// Files written with the RNTupleWriter can be read with the RNTupleReader.
+///
+/// By default Frames have to be written from one thread at a time. In
+/// parallel writing mode each category is instead written via ROOT's
+/// RNTupleParallelWriter and every thread fills its own fill context, such that
+/// several threads can call writeFrame concurrently and only the commits of
+/// full clusters to the file are synchronized. In this mode the order of the
+/// entries in the file is no longer guaranteed to be the order in which
+/// writeFrame has been called. Since ROOT does not allow to append a new
+/// RNTuple to a file while another one is being filled, the first Frame of each
+/// category has to be written before Frames are written concurrently. Threads
+/// that are done writing should call releaseThread to flush and release their
+/// fill contexts.
 class RNTupleWriter {
 public:
   /// Create a RNTupleWriter to write to a file.
   ///
   /// @note Existing files will be overwritten without warning.
   ///
+  /// @note For parallel writing ROOT::EnableThreadSafety() has to be called
+  /// before any Frame is written.
+  ///
   /// @param filename The path to the file that will be created.
-  RNTupleWriter(const std::string& filename);
+  /// @param options  The compression, cluster and page settings to use and
+  ///                 whether Frames can be written concurrently from several
+  ///                 threads
+  ///
+  /// @throws std::invalid_argument if the compression level is not in [1, 9]
+  RNTupleWriter(const std::string& filename, const WriterOptions& options = {});
 
   /// RNTupleWriter destructor
   ///
@@ -59,7 +92,8 @@ public:
 
   /// Store the given frame with the given category.
   ///
-  /// This stores all available collections from the Frame.
+  /// This stores all available collections from the Frame. In parallel
+  /// writing mode this can be called concurrently from several threads.
   ///
   /// @note The contents of the first Frame that is written in this way
   /// determines the contents that will be written for all subsequent Frames.
@@ -70,7 +104,9 @@ public:
 
   /// Store the given Frame with the given category.
   ///
-  /// This stores only the desired collections and not the complete frame.
+  /// This stores only the desired collections and not the complete frame. In
+  /// parallel writing mode this can be called concurrently from several
+  /// threads.
   ///
   /// @note The contents of the first Frame that is written in this way
   /// determines the contents that will be written for all subsequent Frames.
@@ -85,9 +121,25 @@ public:
   /// again.
   ///
   /// @note The destructor will also call this, so letting a RNTupleWriter go out
-  /// of scope is also a viable way to write a readable file
+  /// of scope is also a viable way to write a readable file. In parallel
+  /// writing mode no other thread may still be writing Frames.
   void finish();
 
+  /// Release the fill contexts of the calling thread in parallel writing mode
+  ///
+  /// This commits all Frames that this thread has written but that are not yet
+  /// part of a full cluster. It should be called by every thread that is done
+  /// writing Frames, otherwise the fill contexts are kept until finish is
+  /// called. Writing another Frame from the same thread afterwards creates new
+  /// fill contexts. This does nothing if the writer is not in parallel writing
+  /// mode.
+  void releaseThread();
+
+  /// Check whether this writer is in parallel writing mode
+  bool isParallel() const {
+    return m_options.parallelWriting;
+  }
+
   /// Check whether the collsToWrite are consistent with the state of the passed
   /// category.
   ///
@@ -115,31 +167,52 @@ private:
   /// Helper struct to group all the necessary information for one category.
   struct CategoryInfo {
     std::unique_ptr<root_compat::RNTupleWriter> writer{nullptr}; ///< The RNTupleWriter for this category
+    /// The RNTupleParallelWriter for this category (parallel writing only)
+    std::unique_ptr<root_compat::RNTupleParallelWriter> parallelWriter{nullptr};
+    /// The fill contexts of all threads that have written to this category
+    std::unordered_map<std::thread::id, std::shared_ptr<root_compat::RNTupleFillContext>> fillContexts{};
+    std::unique_ptr<std::mutex> contextMtx{std::make_unique<std::mutex>()}; ///< The mutex guarding the fill contexts
 
     /// Collection info for this category
     std::vector<root_utils::CollectionWriteInfo> collInfo{};
     std::vector<std::string> names{}; ///< The names of all collections to write
 
-    // Storage for the keys & values of all the parameters of this category
-    // (resp. at least the current entry)
+    /// Whether the category has been initialized from its first Frame
+    bool isInitialized() const {
+      return writer != nullptr || parallelWriter != nullptr;
+    }
+  };
+
+  /// Storage for the keys & values of all the parameters of one entry
+  struct ParamStorages {
     root_utils::ParamStorage<int> intParams{};
     root_utils::ParamStorage<float> floatParams{};
     root_utils::ParamStorage<double> doubleParams{};
     root_utils::ParamStorage<std::string> stringParams{};
   };
-  CategoryInfo& getCategoryInfo(std::string_view category);
+
+  /// Get the CategoryInfo for a category, initializing it from the passed
+  /// collections if this is the first Frame of this category
+  CategoryInfo& getCategoryInfo(std::string_view category, const podio::Frame& frame,
+                                const std::vector<std::string>& collsToWrite);
+
+  /// Get the fill context of the calling thread for a category
+  root_compat::RNTupleFillContext& getFillContext(CategoryInfo& catInfo);
 
   template <typename T>
-  void fillParams(const GenericParameters& params, CategoryInfo& catInfo, root_compat::REntry* entry);
+  void fillParams(const GenericParameters& params, ParamStorages& storages, root_compat::REntry* entry);
 
   template <typename T>
-  root_utils::ParamStorage<T>& getParamStorage(CategoryInfo& catInfo);
+  root_utils::ParamStorage<T>& getParamStorage(ParamStorages& storages);
 
   std::unique_ptr<TFile> m_file{};
 
   DatamodelDefinitionCollector m_datamodelCollector{};
 
   podio::StringKeyMap<CategoryInfo> m_categories{};
+  /// The mutex guarding the categories and their initialization
+  std::unique_ptr<std::mutex> m_categoryMtx{std::make_unique<std::mutex>()};
+  WriterOptions m_options{}; ///< The options for writing the categories
 };
 
 } // namespace podio
@@ -113,6 +113,15 @@ public:
 
   std::optional<std::map<std::string, SizeStats>> getSizeStats(std::string_view category);
 
+  /// Open another reader on the same file(s) that shares all the metadata of
+  /// this one, i.e. the file version, the datamodel definitions, the
+  /// collection information and the collection ID tables are not read again.
+  /// The returned reader has its own TChains and keeps track of its own
+  /// entries, so that it can be used on a different thread than this one.
+  ///
+  /// @returns A reader that is ready to read from the same file(s)
+  std::unique_ptr<ROOTReader> openShared();
+
 private:
   /// Helper struct to group together all the necessary state to read / process
   /// a given category. A "category" in this case describes all frames with the
@@ -129,6 +138,8 @@ private:
                                                             ///< category
     std::vector<root_utils::CollectionBranches> branches{}; ///< The branches for this category
     std::shared_ptr<CollectionIDTable> table{nullptr};      ///< The collection ID table for this category
+    std::shared_ptr<const std::vector<root_utils::CollectionWriteInfo>> collInfo{nullptr}; ///< The collection
+                                                                                           ///< infos on file
   };
 
   /// Initialize the passed CategoryInfo by setting up the necessary branches,
@@ -136,6 +147,10 @@ private:
   /// with this name
   void initCategory(CategoryInfo& catInfo, std::string_view name);
 
+  /// Read the collection infos and the collection ID table for the passed
+  /// category from the metadata, unless that has already happened
+  void readCategoryMetadata(CategoryInfo& catInfo, std::string_view name);
+
   /// Get the category information for the given name. In case there is no TTree
   /// with contents for the given name this will return a CategoryInfo with an
   /// uninitialized chain (nullptr) member
@@ -159,6 +174,7 @@ private:
                                                                    bool reloadBranches, unsigned int localEntry);
 
   std::unique_ptr<TChain> m_metaChain{nullptr};                      ///< The metadata tree
+  std::vector<std::string> m_filenames{};                            ///< The files that are read
   std::unordered_map<std::string_view, CategoryInfo> m_categories{}; ///< All categories
 };
 
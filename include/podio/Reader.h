@@ -32,6 +32,7 @@ private:
     virtual std::vector<std::string_view> getAvailableCategories() const = 0;
     virtual const std::string_view getDatamodelDefinition(std::string_view name) const = 0;
     virtual std::vector<std::string> getAvailableDatamodels() const = 0;
+    virtual std::unique_ptr<ReaderConcept> openShared() = 0;
   };
 
 private:
@@ -85,11 +86,18 @@ private:
       return m_reader->getAvailableDatamodels();
     }
 
+    std::unique_ptr<ReaderConcept> openShared() override {
+      return std::make_unique<ReaderModel<T>>(m_reader->openShared());
+    }
+
     std::unique_ptr<T> m_reader;
   };
 
   std::unique_ptr<ReaderConcept> m_self{nullptr};
 
+  Reader(std::unique_ptr<ReaderConcept> self) : m_self(std::move(self)) {
+  }
+
 public:
   /// Create a reader from a low level reader
   ///
@@ -217,6 +225,19 @@ public:
   }
 
   std::optional<std::map<std::string, SizeStats>> getSizeStats(std::string_view category);
+
+  /// Open another Reader on the same file(s) that shares all the metadata with
+  /// this one instead of reading it again
+  ///
+  /// The returned Reader has its own file handles and keeps track of its own
+  /// entries, so that it can be used on a different thread than this one.
+  /// Opening a shared Reader is not thread safe with respect to using this
+  /// Reader.
+  ///
+  /// @returns A Reader that is ready to read from the same file(s)
+  Reader openShared() {
+    return Reader{m_self->openShared()};
+  }
 };
 
 /// Create a Reader that is able to read the file or files matching a glob pattern
@@ -9,6 +9,7 @@
 #include <podio/utilities/TypeHelpers.h>
 
 #include <sio/block.h>
+#include <sio/buffer.h>
 #include <sio/io_device.h>
 #include <sio/version.h>
 
@@ -230,6 +231,34 @@ public:
   std::map<int, GenericParameters>* data{nullptr};
 };
 
+/// A block holding several other (serialized) blocks that have been compressed
+/// independently of each other. This makes it possible to uncompress and read
+/// each of them individually.
+class SIOCompressedBlocksBlock : public sio::block {
+public:
+  /// One serialized and compressed block
+  struct CompressedBlock {
+    uint32_t uncompressedSize{0}; ///< The size of the serialized block
+    sio::buffer data{1};          ///< The compressed serialized block
+  };
+
+  SIOCompressedBlocksBlock() : sio::block("podio_compressed_blocks", sio::version::encode_version(0, 1)) {
+  }
+
+  SIOCompressedBlocksBlock(const SIOCompressedBlocksBlock&) = delete;
+  SIOCompressedBlocksBlock& operator=(const SIOCompressedBlocksBlock&) = delete;
+
+  void read(sio::read_device& device, sio::version_type version) override;
+  void write(sio::write_device& device) override;
+
+  uint32_t codec{0};                     ///< The codec with which the blocks have been compressed
+  std::vector<CompressedBlock> blocks{}; ///< The compressed blocks in the order they have been written
+  /// The blocks to read. If not empty, the compressed data of the blocks at
+  /// indices for which this is 0 is skipped when reading and their data stay
+  /// empty
+  std::vector<short> readMask{};
+};
+
 /// factory for creating sio::blocks for a given type of EDM-collection
 class SIOBlockFactory {
 private:
@@ -279,19 +308,40 @@ public:
 };
 
 namespace sio_helpers {
-  /// marker for showing that a TOC has been stored in the file
+  /// marker for showing that a TOC has been stored in the file with a 32 bit
+  /// start position (files written before 64 bit positions were introduced)
   static constexpr uint32_t SIOTocMarker = 0xc001fea7;
-  /// the number of bits necessary to store the SIOTocMarker and the actual
+  /// marker for showing that a TOC has been stored in the file with a 64 bit
+  /// start position
+  static constexpr uint32_t SIOTocMarker64 = 0xc001fea8;
+  /// the number of bytes necessary to store the SIOTocMarker and the actual
   /// position of the start of the SIOFileTOCRecord
   static constexpr int SIOTocInfoSize = sizeof(uint64_t); // i.e. usually 8
+  /// the number of bytes necessary to store the SIOTocMarker64 and the 64 bit
+  /// position of the start of the SIOFileTOCRecord. The position is stored in
+  /// front of the marker
+  static constexpr int SIOTocInfoSize64 = 2 * sizeof(uint64_t);
   /// The name of the TOCRecord
   static constexpr const char* SIOTocRecordName = "podio_SIO_TOC_Record";
 
   /// The name of the record containing the EDM definitions in json format
   static constexpr const char* SIOEDMDefinitionName = "podio_SIO_EDMDefinitions";
 
-  // should hopefully be enough for all practical purposes
-  using position_type = uint32_t;
+  /// The type of the record positions in the file. Files written before 64 bit
+  /// positions were introduced store them as uint32_t
+  using position_type = uint64_t;
+
+  /// The codecs that can be used to compress records. The codec is stored in
+  /// the options of the record header. ZLIB has to remain 0 in order to be able
+  /// to read files that have been written before other codecs were available
+  enum class Codec : uint32_t { ZLIB = 0, ZSTD = 1, LZ4 = 2, None = 0xff };
+  /// The position of the codec in the options of the record header
+  static constexpr uint32_t SIOCodecShift = 8;
+  /// The bits of the record header options that are used for the codec
+  static constexpr uint32_t SIOCodecMask = 0xff << SIOCodecShift;
+  /// The bit of the record header options that marks records that contain an
+  /// SIOCompressedBlocksBlock instead of directly the blocks
+  static constexpr uint32_t SIOBlockCompressionFlag = 1u << 16;
 } // namespace sio_helpers
 
 class SIOFileTOCRecord {
@@ -310,6 +360,10 @@ public:
   /// Get all the record names that are stored in this TOC record
   std::vector<std::string_view> getRecordNames() const;
 
+  /// Check whether all positions fit into 32 bits, i.e. whether they can be
+  /// stored in the format that is understood by older podio versions
+  bool hasOnly32BitPositions() const;
+
 private:
   friend struct SIOFileTOCRecordBlock;
 
@@ -319,12 +373,18 @@ private:
   MapType m_recordMap{};
 };
 
+/// The block for (de)serializing the SIOFileTOCRecord. Version 0.1 stores the
+/// positions as 32 bit, version 0.2 as 64 bit integers. Version 0.1 is written
+/// as long as all positions fit into 32 bits in order to keep files readable
+/// for older podio versions
 struct SIOFileTOCRecordBlock : public sio::block {
-  SIOFileTOCRecordBlock() : sio::block(sio_helpers::SIOTocRecordName, sio::version::encode_version(0, 1)) {
+  SIOFileTOCRecordBlock() : sio::block(sio_helpers::SIOTocRecordName, sio::version::encode_version(0, 2)) {
   }
 
   SIOFileTOCRecordBlock(SIOFileTOCRecord* r) :
-      sio::block(sio_helpers::SIOTocRecordName, sio::version::encode_version(0, 1)), record(r) {
+      sio::block(sio_helpers::SIOTocRecordName,
+                 r->hasOnly32BitPositions() ? sio::version::encode_version(0, 1) : sio::version::encode_version(0, 2)),
+      record(r) {
   }
 
   SIOFileTOCRecordBlock(const SIOFileTOCRecordBlock&) = delete;
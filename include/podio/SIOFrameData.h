@@ -4,10 +4,12 @@
 #include "podio/CollectionBuffers.h"
 #include "podio/CollectionIDTable.h"
 #include "podio/GenericParameters.h"
+#include "podio/SIOBlock.h"
 
 #include <sio/buffer.h>
 #include <sio/definitions.h>
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -16,6 +18,9 @@ namespace podio {
 /// The Frame data container for the SIO backend. It is constructed from the
 /// compressed sio::buffers that is read from file and does all the necessary
 /// unpacking and decompressing internally after construction.
+///
+/// If the collections have been compressed independently of each other, only
+/// the collections that are actually requested are decompressed and read.
 class SIOFrameData {
 
 public:
@@ -31,12 +36,22 @@ public:
   /// Constructor from the collBuffers containing the collection data and a
   /// tableBuffer containing the necessary information for unpacking the
   /// collections. The two size parameters denote the uncompressed size of the
-  /// respective buffers.
+  /// respective buffers and the two codecs the codecs with which they have
+  /// been compressed. If blockCompressed is true, the collBuffers contain an
+  /// SIOCompressedBlocksBlock with the independently compressed collections.
   ///
   /// In case the limitColls contain a collection name that is not available
   /// from the idTable names this throws an exception
   SIOFrameData(sio::buffer&& collBuffers, std::size_t dataSize, sio::buffer&& tableBuffer, std::size_t tableSize,
-               std::vector<std::string> limitColls = {});
+               std::vector<std::string> limitColls = {}, sio_helpers::Codec dataCodec = sio_helpers::Codec::ZLIB,
+               sio_helpers::Codec tableCodec = sio_helpers::Codec::ZLIB, bool blockCompressed = false);
+
+  /// Constructor from views into a memory mapped file instead of buffers. The
+  /// mappedFile is kept alive as long as the views are needed. Otherwise the
+  /// arguments have the same meaning as for the constructor taking buffers.
+  SIOFrameData(std::shared_ptr<const void> mappedFile, sio::buffer_span collBuffers, std::size_t dataSize,
+               sio::buffer_span tableBuffer, std::size_t tableSize, std::vector<std::string> limitColls,
+               sio_helpers::Codec dataCodec, sio_helpers::Codec tableCodec, bool blockCompressed);
 
   std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name);
 
@@ -51,18 +66,42 @@ public:
 private:
   void unpackBuffers();
 
+  /// Read the block with the given index, in case the blocks have been
+  /// compressed independently
+  void readBlock(size_t index);
+
   void readIdTable();
 
+  /// Check that all collections in m_limitColls are available
+  void checkLimitColls() const;
+
   void createBlocks();
 
+  /// The (compressed) record data, either from the buffer or the mapped file
+  sio::buffer_span recordSpan() const;
+  /// The (compressed) table data, either from the buffer or the mapped file
+  sio::buffer_span tableSpan() const;
+
   // Default initialization doesn't really matter here, because they are made
   // the correct size on construction
   sio::buffer m_recBuffer{sio::kbyte};   ///< The compressed record (data) buffer
   sio::buffer m_tableBuffer{sio::kbyte}; ///< The compressed collection id table buffer
 
+  std::shared_ptr<const void> m_mappedFile{nullptr}; ///< The mapped file if the data are viewed from it
+  sio::buffer_span m_recSpan{};                      ///< The view of the record in the mapped file
+  sio::buffer_span m_tableSpan{};                    ///< The view of the table in the mapped file
+
   std::size_t m_dataSize{};  ///< Uncompressed data buffer size
   std::size_t m_tableSize{}; ///< Uncompressed table size
 
+  sio_helpers::Codec m_dataCodec{sio_helpers::Codec::ZLIB};  ///< The codec of the data buffer
+  sio_helpers::Codec m_tableCodec{sio_helpers::Codec::ZLIB}; ///< The codec of the table buffer
+
+  bool m_blockCompressed{false}; ///< Whether all blocks have been compressed independently
+  /// The independently compressed blocks (if blockCompressed)
+  std::vector<SIOCompressedBlocksBlock::CompressedBlock> m_compressedBlocks{};
+  sio_helpers::Codec m_blockCodec{sio_helpers::Codec::ZLIB}; ///< The codec of the independently compressed blocks
+
   std::vector<short> m_availableBlocks{}; ///< The blocks that have already been retrieved
 
   sio::block_list m_blocks{};
@@ -16,16 +16,28 @@ namespace podio {
 
 class CollectionIDTable;
 
+namespace sio_utils {
+  class MappedFile;
+}
+
 /// The SIOReader can be used to read files that have been written with the SIO
 /// backend.
 ///
 /// The SIOReader provides the data as SIOFrameData from which a podio::Frame
 /// can be constructed. It can be used to read files written by the SIOWriter.
+///
+/// By default the file is mapped into memory and the SIOFrameData directly
+/// view the records in the mapped file, instead of first copying them into
+/// separate buffers. Uncompressed records are unpacked directly from the mapped
+/// file. If the file cannot be mapped, the SIOReader falls back to reading
+/// the records from a stream.
 class SIOReader : public ReaderCommon {
 
 public:
   /// Create an SIOReader
-  SIOReader();
+  ///
+  /// @param useMemoryMap Whether the file should be mapped into memory
+  SIOReader(bool useMemoryMap = true);
   /// SIOReader destructor
   ~SIOReader() = default;
 
@@ -37,10 +49,10 @@ public:
   /// Read the next data entry for a given category.
   ///
   /// @note Given how the SIO files are currently laid out it is in fact not
-  /// possible to only read a subset of a Frame. Rather the subset of
-  /// collections to read will be an artificial limit on the returned
-  /// SIOFrameData. Limiting the collections to read will not improve I/O
-  /// performance.
+  /// possible to only read a subset of a Frame from file. Rather the subset of
+  /// collections to read will be a limit on the returned SIOFrameData. For
+  /// files in which the collections are compressed independently, only the
+  /// requested collections will be decompressed and unpacked.
   ///
   /// @param name The category name for which to read the next entry
   /// @param collsToRead (optional) the collection names that should be read. If
@@ -55,10 +67,10 @@ public:
   /// Read the desired data entry for a given category.
   ///
   /// @note Given how the SIO files are currently laid out it is in fact not
-  /// possible to only read a subset of a Frame. Rather the subset of
-  /// collections to read will be an artificial limit on the returned
-  /// SIOFrameData. Limiting the collections to read will not improve I/O
-  /// performance.
+  /// possible to only read a subset of a Frame from file. Rather the subset of
+  /// collections to read will be a limit on the returned SIOFrameData. For
+  /// files in which the collections are compressed independently, only the
+  /// requested collections will be decompressed and unpacked.
   ///
   /// @param name  The category name for which to read the next entry
   /// @param entry The entry number to read
@@ -82,6 +94,15 @@ public:
   /// @param filename The path to the file to read from
   void openFile(const std::string& filename);
 
+  /// Open another reader on the same file that shares all the metadata of this
+  /// one, i.e. the file version, the datamodel definitions and the table of
+  /// contents are not read again. The returned reader has its own file handle
+  /// and keeps track of its own entries, so that it can be used on a different
+  /// thread than this one.
+  ///
+  /// @returns A reader that is ready to read from the same file
+  std::unique_ptr<SIOReader> openShared() const;
+
 private:
   void readPodioHeader();
 
@@ -91,6 +112,10 @@ private:
   void readEDMDefinitions();
 
   sio::ifstream m_stream{}; ///< The stream from which we read
+  std::string m_filename{}; ///< The name of the file that is read
+
+  bool m_useMemoryMap{true};                                          ///< Whether the file should be mapped into memory
+  std::shared_ptr<const sio_utils::MappedFile> m_mappedFile{nullptr}; ///< The memory mapped file (if mapped)
 
   /// Count how many times each an entry of this name has been read already
   std::unordered_map<std::string, unsigned> m_nameCtr{};
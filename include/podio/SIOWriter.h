@@ -2,6 +2,7 @@
 #define PODIO_SIOWRITER_H
 
 #include "podio/SIOBlock.h"
+#include "podio/WriterOptions.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
 #include <sio/definitions.h>
@@ -29,7 +30,14 @@ public:
   /// @note Existing files will be overwritten without warning.
   ///
   /// @param filename The path to the file that will be created.
-  SIOWriter(const std::string& filename);
+  /// @param options  The compression to use for the records. Only the
+  ///                 compression algorithm and level are considered. zlib is
+  ///                 used by default, zstd and lz4 are available if support
+  ///                 for them has been built
+  ///
+  /// @throws std::invalid_argument if the compression is not available, the
+  /// compression level is not in [1, 9] or parallel writing is requested
+  SIOWriter(const std::string& filename, const WriterOptions& options = {});
 
   /// SIOWriter destructor
   ///
@@ -71,8 +79,11 @@ public:
   void finish();
 
 private:
-  sio::ofstream m_stream{};       ///< The output file stream
-  SIOFileTOCRecord m_tocRecord{}; ///< The "table of contents" of the written file
+  sio_helpers::Codec m_codec{sio_helpers::Codec::ZLIB}; ///< The codec that is used for compressing records
+  int m_compressionLevel{0};                            ///< The compression level (0 for the codec default)
+  bool m_compressIndependently{false};                  ///< Whether collections are compressed independently
+  sio::ofstream m_stream{};                             ///< The output file stream
+  SIOFileTOCRecord m_tocRecord{};                       ///< The "table of contents" of the written file
   DatamodelDefinitionCollector m_datamodelCollector{};
 };
 } // namespace podio
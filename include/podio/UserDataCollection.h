@@ -135,6 +135,11 @@ public:
     return true;
   }
 
+  /// no references to defer
+  bool deferReferences(const ICollectionProvider*) override {
+    return false;
+  }
+
   /// set collection ID
   void setID(uint32_t id) override {
     m_collectionID = id;
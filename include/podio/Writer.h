@@ -2,6 +2,7 @@
 #define PODIO_WRITER_H
 
 #include "podio/Frame.h"
+#include "podio/WriterOptions.h"
 
 namespace podio {
 
@@ -26,6 +27,7 @@ private:
     virtual void writeFrame(const podio::Frame& frame, std::string_view category,
                             const std::vector<std::string>& collections) = 0;
     virtual void finish() = 0;
+    virtual void releaseThread() = 0;
   };
 
 private:
@@ -47,6 +49,11 @@ private:
     void finish() override {
       return m_writer->finish();
     }
+    void releaseThread() override {
+      if constexpr (requires { m_writer->releaseThread(); }) {
+        m_writer->releaseThread();
+      }
+    }
     std::unique_ptr<T> m_writer{nullptr};
   };
 
@@ -121,6 +128,15 @@ public:
   void finish() {
     return m_self->finish();
   }
+
+  /// Release the resources that the calling thread holds for writing
+  ///
+  /// Threads that are done writing should call this if the Writer has been
+  /// created for parallel writing. This does nothing for writers that do not
+  /// support parallel writing.
+  void releaseThread() {
+    return m_self->releaseThread();
+  }
 };
 
 /// Create a Writer that is able to write files for the desired backend
@@ -132,13 +148,19 @@ public:
 /// @param type     The (optional) type argument to switch between RNTuple and TTree
 ///                 based backend in case the suffix is ".root". Will be ignored
 ///                 in case the suffix is ".sio"
+/// @param options  The (optional) options that are passed on to the backend
+///                 writer. See WriterOptions for which backends support which
+///                 options
 ///
 /// @returns A fully initialized Writer for the I/O backend that has been
 ///         determined
 ///
 /// @throws std::runtime_error In case the suffix can not be associated to an
 ///         I/O backend or if support for the desired I/O backend has not been built
-Writer makeWriter(const std::string& filename, const std::string& type = "default");
+/// @throws std::invalid_argument In case parallel writing or a compression is
+///         requested that the I/O backend does not support
+Writer makeWriter(const std::string& filename, const std::string& type = "default",
+                  const WriterOptions& options = {});
 
 } // namespace podio
 
@@ -0,0 +1,55 @@
+#ifndef PODIO_WRITEROPTIONS_H
+#define PODIO_WRITEROPTIONS_H
+
+#include <cstddef>
+#include <optional>
+
+namespace podio {
+
+/// Configuration options for the writers
+///
+/// All options are optional and the defaults of the respective I/O backend are
+/// used for those that are not set. Requesting parallel writing or a compression
+/// from a backend that does not support it is an error, other options that are
+/// not supported by a backend are ignored by it.
+struct WriterOptions {
+  /// The available compression algorithms
+  enum class Compression {
+    Default, ///< Use the default algorithm of the backend
+    None,    ///< Do not compress the data
+    ZLIB,
+    LZMA,
+    LZ4,
+    ZSTD,
+  };
+
+  /// The compression algorithm to use. SIO supports ZLIB (default) and, if
+  /// support has been built, ZSTD and LZ4
+  Compression compression{Compression::Default};
+  /// The compression level (1 - 9). Uses the default level of the algorithm if
+  /// not set
+  std::optional<int> compressionLevel{};
+  /// Whether the collections of a Frame are compressed independently of each
+  /// other, such that reading only some of them does not require decompressing
+  /// all of them. Files written with this can not be read by podio versions
+  /// that do not support it (SIO only)
+  bool compressCollectionsIndependently{false};
+
+  /// The approximate size of a compressed cluster in bytes (RNTuple only)
+  std::optional<size_t> approxZippedClusterSize{};
+  /// The maximum size of an uncompressed cluster in bytes (RNTuple only)
+  std::optional<size_t> maxUnzippedClusterSize{};
+  /// The maximum size of an uncompressed page in bytes (RNTuple only)
+  std::optional<size_t> maxUnzippedPageSize{};
+  /// Whether pages are buffered and compressed before they are written. Turning
+  /// this off lowers the memory usage at the cost of throughput (RNTuple only)
+  std::optional<bool> useBufferedWrite{};
+
+  /// Whether Frames can be written concurrently from several threads (RNTuple
+  /// only)
+  bool parallelWriting{false};
+};
+
+} // namespace podio
+
+#endif // PODIO_WRITEROPTIONS_H
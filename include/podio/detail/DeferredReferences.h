@@ -0,0 +1,42 @@
+#ifndef PODIO_DETAIL_DEFERREDREFERENCES_H
+#define PODIO_DETAIL_DEFERREDREFERENCES_H
+
+#include "podio/CollectionBase.h"
+#include "podio/ICollectionProvider.h"
+
+#include <mutex>
+
+namespace podio::detail {
+
+/// The deferred setReferences call of a collection that has been read and
+/// whose relations are only resolved once they are first accessed.
+///
+/// The objects of such a collection hold a pointer to this and call resolve
+/// before they access any of their relations. Resolving the references happens
+/// exactly once, even if several threads access relations concurrently.
+class DeferredReferences {
+public:
+  DeferredReferences(podio::CollectionBase* collection, const podio::ICollectionProvider* provider) :
+      m_collection(collection), m_provider(provider) {
+  }
+
+  DeferredReferences(const DeferredReferences&) = delete;
+  DeferredReferences& operator=(const DeferredReferences&) = delete;
+  DeferredReferences(DeferredReferences&&) = delete;
+  DeferredReferences& operator=(DeferredReferences&&) = delete;
+  ~DeferredReferences() = default;
+
+  /// Resolve the references of the collection if that has not yet happened
+  void resolve() const {
+    std::call_once(m_resolved, [this]() { m_collection->setReferences(m_provider); });
+  }
+
+private:
+  podio::CollectionBase* m_collection{nullptr};
+  const podio::ICollectionProvider* m_provider{nullptr};
+  mutable std::once_flag m_resolved{};
+};
+
+} // namespace podio::detail
+
+#endif // PODIO_DETAIL_DEFERREDREFERENCES_H
@@ -102,12 +102,8 @@ public:
   MutableLink<FromU, ToU> clone(bool cloneRelations = true) const {
     auto tmp = new LinkObjT(podio::ObjectID{}, m_obj->data);
     if (cloneRelations) {
-      if (m_obj->m_from) {
-        tmp->m_from = std::make_unique<FromT>(*m_obj->m_from);
-      }
-      if (m_obj->m_to) {
-        tmp->m_to = std::make_unique<ToT>(*m_obj->m_to);
-      }
+      tmp->m_from = m_obj->m_from;
+      tmp->m_to = m_obj->m_to;
     }
     return MutableLink<FromU, ToU>(podio::utils::MaybeSharedPtr(tmp, podio::utils::MarkOwned));
   }
@@ -136,10 +132,7 @@ public:
 
   /// Access the related-from object
   const FromT getFrom() const {
-    if (!m_obj->m_from) {
-      return FromT::makeEmpty();
-    }
-    return FromT(*(m_obj->m_from));
+    return m_obj->m_from.get();
   }
 
   /// Set the related-from object
@@ -151,7 +144,7 @@ public:
     requires(Mutable && std::is_same_v<detail::GetDefaultHandleType<FromU>, FromT> &&
              detail::isDefaultHandleType<FromU>)
   void setFrom(FromU value) {
-    m_obj->m_from = std::make_unique<detail::GetDefaultHandleType<FromU>>(value);
+    m_obj->m_from.set(value);
   }
 
   /// Set the related-from object
@@ -179,10 +172,7 @@ public:
 
   /// Access the related-to object
   const ToT getTo() const {
-    if (!m_obj->m_to) {
-      return ToT::makeEmpty();
-    }
-    return ToT(*(m_obj->m_to));
+    return m_obj->m_to.get();
   }
 
   /// Set the related-to object
@@ -193,7 +183,7 @@ public:
   template <typename ToU>
     requires(Mutable && std::is_same_v<detail::GetDefaultHandleType<ToU>, ToT> && detail::isDefaultHandleType<ToU>)
   void setTo(ToU value) {
-    m_obj->m_to = std::make_unique<detail::GetDefaultHandleType<ToU>>(value);
+    m_obj->m_to.set(value);
   }
 
   /// Set the related-to object
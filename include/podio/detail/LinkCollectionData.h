@@ -6,6 +6,7 @@
 
 #include "podio/CollectionBase.h"
 #include "podio/CollectionBuffers.h"
+#include "podio/CollectionPool.h"
 #include "podio/ICollectionProvider.h"
 #include "podio/detail/RelationIOHelpers.h"
 
@@ -20,10 +21,12 @@ public:
   LinkObjPointerContainer<FromT, ToT> entries{};
 
   LinkCollectionData() :
-      m_rel_from(new std::vector<FromT>()), m_rel_to(new std::vector<ToT>()), m_data(new LinkDataContainer()) {
+      m_rel_from(new std::vector<FromT>()),
+      m_rel_to(new std::vector<ToT>()),
+      m_data(podio::CollectionPool::acquire<LinkData>()) {
     m_refCollections.reserve(2);
-    m_refCollections.emplace_back(std::make_unique<std::vector<podio::ObjectID>>());
-    m_refCollections.emplace_back(std::make_unique<std::vector<podio::ObjectID>>());
+    m_refCollections.emplace_back(podio::CollectionPool::acquire<podio::ObjectID>());
+    m_refCollections.emplace_back(podio::CollectionPool::acquire<podio::ObjectID>());
   }
 
   LinkCollectionData(podio::CollectionReadBuffers&& buffers, bool isSubsetColl) :
@@ -45,7 +48,12 @@ public:
   LinkCollectionData& operator=(const LinkCollectionData&) = delete;
   LinkCollectionData(LinkCollectionData&&) = default;
   LinkCollectionData& operator=(LinkCollectionData&&) = default;
-  ~LinkCollectionData() = default;
+  ~LinkCollectionData() {
+    podio::CollectionPool::release(std::move(m_data));
+    for (auto& pointer : m_refCollections) {
+      podio::CollectionPool::release(std::move(pointer));
+    }
+  }
 
   podio::CollectionWriteBuffers getCollectionBuffers(bool isSubsetColl) {
     return {isSubsetColl ? nullptr : static_cast<void*>(&m_data), static_cast<void*>(m_data.get()), &m_refCollections,
@@ -107,18 +115,8 @@ public:
     m_data->reserve(entries.size());
     for (const auto obj : entries) {
       m_data->push_back(obj->data);
-
-      if (obj->m_from) {
-        m_refCollections[0]->emplace_back(obj->m_from->getObjectID());
-      } else {
-        m_refCollections[0]->push_back({podio::ObjectID::invalid, 0});
-      }
-
-      if (obj->m_to) {
-        m_refCollections[1]->emplace_back(obj->m_to->getObjectID());
-      } else {
-        m_refCollections[1]->push_back({podio::ObjectID::invalid, 0});
-      }
+      m_refCollections[0]->emplace_back(obj->m_from.getObjectID());
+      m_refCollections[1]->emplace_back(obj->m_to.getObjectID());
     }
   }
 
@@ -133,11 +131,12 @@ public:
   }
 
   bool setReferences(const podio::ICollectionProvider* collectionProvider, bool isSubsetColl) {
+    // Make sure to request each referenced collection only once
+    auto resolver = podio::detail::CollectionResolver(collectionProvider);
     if (isSubsetColl) {
       for (const auto& id : *m_refCollections[0]) {
-        podio::CollectionBase* coll{nullptr};
         LinkObj<FromT, ToT>* obj{nullptr};
-        if (collectionProvider->get(id.collectionID, coll)) {
+        if (auto* coll = resolver.get(id.collectionID)) {
           auto* tmp_coll = static_cast<LinkCollection<FromT, ToT>*>(coll);
           obj = tmp_coll->m_storage.entries[id.index];
         }
@@ -146,32 +145,23 @@ public:
       return true; // TODO: check success, how?
     }
 
-    // Normal collections have to resolve all relations
+    // Normal collections have to resolve all relations. Only the collections
+    // are resolved here, handles to the objects are created on access
     for (size_t i = 0; i < entries.size(); ++i) {
       const auto id = (*m_refCollections[0])[i];
-      if (id.index != podio::ObjectID::invalid) {
-        podio::CollectionBase* coll = nullptr;
-        if (!collectionProvider->get(id.collectionID, coll)) {
-          entries[i]->m_from = nullptr;
-          continue;
-        }
-        podio::detail::addSingleRelation(entries[i]->m_from, coll, id);
+      if (const auto* coll = id.index != podio::ObjectID::invalid ? resolver.get(id.collectionID) : nullptr) {
+        entries[i]->m_from.set(coll, id);
       } else {
-        entries[i]->m_from = nullptr;
+        entries[i]->m_from.reset();
       }
     }
 
     for (size_t i = 0; i < entries.size(); ++i) {
       const auto id = (*m_refCollections[1])[i];
-      if (id.index != podio::ObjectID::invalid) {
-        podio::CollectionBase* coll = nullptr;
-        if (!collectionProvider->get(id.collectionID, coll)) {
-          entries[i]->m_to = nullptr;
-          continue;
-        }
-        podio::detail::addSingleRelation(entries[i]->m_to, coll, id);
+      if (const auto* coll = id.index != podio::ObjectID::invalid ? resolver.get(id.collectionID) : nullptr) {
+        entries[i]->m_to.set(coll, id);
       } else {
-        entries[i]->m_to = nullptr;
+        entries[i]->m_to.reset();
       }
     }
 
@@ -181,14 +171,17 @@ public:
   void makeSubsetCollection() {
     // Subset collections do not need all the data buffers that normal
     // collections need, so we can free them here
-    m_data.reset(nullptr);
+    podio::CollectionPool::release(std::move(m_data));
 
     m_rel_from.reset(nullptr);
     m_rel_to.reset(nullptr);
 
     // Subset collections need one vector of ObjectIDs for I/O purposes.
+    for (auto& pointer : m_refCollections) {
+      podio::CollectionPool::release(std::move(pointer));
+    }
     m_refCollections.resize(1);
-    m_refCollections[0] = std::make_unique<std::vector<podio::ObjectID>>();
+    m_refCollections[0] = podio::CollectionPool::acquire<podio::ObjectID>();
   }
 
 private:
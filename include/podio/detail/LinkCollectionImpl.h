@@ -352,6 +352,11 @@ public:
     return m_storage.setReferences(collectionProvider, m_isSubsetColl);
   }
 
+  bool deferReferences(const ICollectionProvider*) override {
+    // Links are always resolved directly
+    return false;
+  }
+
   static constexpr SchemaVersionT schemaVersion = 1;
 
   SchemaVersionT getSchemaVersion() const override {
@@ -399,14 +404,14 @@ namespace detail {
     auto readBuffers = podio::CollectionReadBuffers{};
     readBuffers.type = podio::LinkCollection<FromT, ToT>::typeName;
     readBuffers.schemaVersion = podio::LinkCollection<FromT, ToT>::schemaVersion;
-    readBuffers.data = subsetColl ? nullptr : new LinkDataContainer();
+    readBuffers.data = subsetColl ? nullptr : podio::CollectionPool::acquire<LinkData>().release();
 
     // Either it is a subset collection or we have two relations
     const auto nRefs = subsetColl ? 1 : 2;
     readBuffers.references = new podio::CollRefCollection(nRefs);
     for (auto& ref : *readBuffers.references) {
       // Make sure to place usable buffer pointers here
-      ref = std::make_unique<std::vector<podio::ObjectID>>();
+      ref = podio::CollectionPool::acquire<podio::ObjectID>();
     }
 
     readBuffers.createCollection = [](podio::CollectionReadBuffers&& buffers, bool isSubsetColl) {
@@ -419,9 +424,14 @@ namespace detail {
         // If we have data then we are not a subset collection and we have
         // to clean up all type erased buffers by casting them back to
         // something that we can delete
-        delete static_cast<LinkDataContainer*>(buffers.data);
+        podio::CollectionPool::release(podio::UVecPtr<LinkData>(static_cast<LinkDataContainer*>(buffers.data)));
         buffers.data = nullptr;
       }
+      if (buffers.references) {
+        for (auto& ref : *buffers.references) {
+          podio::CollectionPool::release(std::move(ref));
+        }
+      }
       delete buffers.references;
       buffers.references = nullptr;
       delete buffers.vectorMembers;
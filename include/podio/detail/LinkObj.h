@@ -2,11 +2,11 @@
 #define PODIO_DETAIL_LINKOBJ_H
 
 #include "podio/detail/LinkFwd.h"
+#include "podio/detail/SingleRelation.h"
 
+#include "podio/CollectionBase.h"
 #include "podio/ObjectID.h"
 
-#include <memory>
-
 namespace podio {
 
 template <typename FromT, typename ToT>
@@ -17,7 +17,7 @@ class LinkObj {
 
 public:
   /// Constructor
-  LinkObj() : id(), data(LinkData{1.0f}), m_from(nullptr), m_to(nullptr) {
+  LinkObj() : id(), data(LinkData{1.0f}) {
   }
 
   /// Constructor from ObjectID and data (does not initialize relations yet!)
@@ -25,13 +25,7 @@ public:
   }
 
   /// Copy constructor (deep-copy of relations)
-  LinkObj(const LinkObj& other) : id(), data(other.data), m_from(nullptr), m_to(nullptr) {
-    if (other.m_from) {
-      m_from = new FromT(*other.m_from);
-    }
-    if (other.m_to) {
-      m_to = new ToT(*other.m_to);
-    }
+  LinkObj(const LinkObj& other) : id(), data(other.data), m_from(other.m_from), m_to(other.m_to) {
   }
 
   /// No assignment operator
@@ -44,8 +38,8 @@ public:
   podio::ObjectID id{};
   LinkData data{1.0f};
 
-  std::unique_ptr<FromT> m_from{nullptr};
-  std::unique_ptr<ToT> m_to{nullptr};
+  detail::SingleRelation<FromT> m_from{};
+  detail::SingleRelation<ToT> m_to{};
 };
 
 } // namespace podio
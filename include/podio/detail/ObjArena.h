@@ -0,0 +1,156 @@
+#ifndef PODIO_DETAIL_OBJARENA_H
+#define PODIO_DETAIL_OBJARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace podio::detail {
+
+/// Slab storage for the Obj instances that are owned by a collection.
+///
+/// Objs are constructed in place into contiguous blocks of memory that grow
+/// geometrically. Filling a collection with N elements therefore needs
+/// O(log N) allocations, and exactly one if the final size is known upfront.
+/// All Objs are destroyed in one go when the arena is cleared. Pointers to Objs
+/// that live in the arena stay valid until the arena is cleared or destroyed,
+/// even if the arena itself is moved. The memory is obtained from a memory
+/// resource, which has to outlive the arena.
+///
+/// @tparam ObjT The Obj type that is stored in the arena
+template <typename ObjT>
+class ObjArena {
+  /// A contiguous chunk of memory holding up to capacity Objs, of which the
+  /// first size are constructed
+  struct Block {
+    ObjT* begin{nullptr};
+    size_t capacity{0};
+    size_t size{0};
+  };
+
+  /// The minimal number of Objs for which space is allocated at once
+  static constexpr size_t MinBlockSize = 32;
+
+public:
+  ObjArena() = default;
+  /// Create an arena that obtains its memory from the passed resource. Uses
+  /// the default new / delete based allocation if resource is a nullptr
+  explicit ObjArena(std::pmr::memory_resource* resource) :
+      m_resource(resource ? resource : std::pmr::new_delete_resource()) {
+  }
+  ~ObjArena() {
+    release();
+  }
+
+  ObjArena(const ObjArena&) = delete;
+  ObjArena& operator=(const ObjArena&) = delete;
+
+  ObjArena(ObjArena&& other) noexcept :
+      m_blocks(std::move(other.m_blocks)), m_capacity(other.m_capacity), m_resource(other.m_resource) {
+    other.m_blocks.clear();
+    other.m_capacity = 0;
+  }
+
+  ObjArena& operator=(ObjArena&& other) noexcept {
+    if (this != &other) {
+      release();
+      m_blocks = std::move(other.m_blocks);
+      m_capacity = other.m_capacity;
+      m_resource = other.m_resource;
+      other.m_blocks.clear();
+      other.m_capacity = 0;
+    }
+    return *this;
+  }
+
+  /// Make sure that at least n more Objs can be created without an additional
+  /// allocation
+  void reserve(size_t n) {
+    if (n == 0 || (!m_blocks.empty() && m_blocks.back().capacity - m_blocks.back().size >= n)) {
+      return;
+    }
+    addBlock(n);
+  }
+
+  /// Construct a new Obj in place and return a pointer to it. The arena keeps
+  /// ownership of the Obj.
+  template <typename... Args>
+  ObjT* emplace(Args&&... args) {
+    if (m_blocks.empty() || m_blocks.back().size == m_blocks.back().capacity) {
+      addBlock(std::max(MinBlockSize, m_capacity));
+    }
+    auto& block = m_blocks.back();
+    auto* obj = std::construct_at(block.begin + block.size, std::forward<Args>(args)...);
+    ++block.size;
+    return obj;
+  }
+
+  /// Check whether the passed Obj lives in (and is owned by) this arena
+  bool contains(const ObjT* obj) const {
+    return std::ranges::any_of(m_blocks, [obj](const Block& block) {
+      return !std::less<const ObjT*>{}(obj, block.begin) && std::less<const ObjT*>{}(obj, block.begin + block.size);
+    });
+  }
+
+  /// The number of Objs that currently live in the arena
+  size_t size() const {
+    size_t total = 0;
+    for (const auto& block : m_blocks) {
+      total += block.size;
+    }
+    return total;
+  }
+
+  /// Destroy all Objs in the arena. The largest block of memory is kept for
+  /// re-use, all others are released
+  void clear() {
+    if (m_blocks.empty()) {
+      return;
+    }
+    auto largest = std::ranges::max_element(m_blocks, {}, &Block::capacity);
+    std::swap(*largest, m_blocks.front());
+    for (auto& block : m_blocks) {
+      std::destroy_n(block.begin, block.size);
+      block.size = 0;
+    }
+    for (auto it = std::next(m_blocks.begin()); it != m_blocks.end(); ++it) {
+      deallocate(*it);
+    }
+    m_blocks.resize(1);
+    m_capacity = m_blocks.front().capacity;
+  }
+
+private:
+  void addBlock(size_t capacity) {
+    // Reserve first to not leak the new block in case this throws
+    m_blocks.reserve(m_blocks.size() + 1);
+    auto* begin = static_cast<ObjT*>(m_resource->allocate(capacity * sizeof(ObjT), alignof(ObjT)));
+    m_blocks.push_back(Block{begin, capacity, 0});
+    m_capacity += capacity;
+  }
+
+  void release() {
+    for (auto& block : m_blocks) {
+      std::destroy_n(block.begin, block.size);
+      deallocate(block);
+    }
+    m_blocks.clear();
+    m_capacity = 0;
+  }
+
+  void deallocate(const Block& block) {
+    m_resource->deallocate(block.begin, block.capacity * sizeof(ObjT), alignof(ObjT));
+  }
+
+  std::vector<Block> m_blocks{}; ///< The blocks of memory, new Objs are only placed into the last one
+  size_t m_capacity{0};          ///< The total capacity of all blocks
+  std::pmr::memory_resource* m_resource{std::pmr::new_delete_resource()}; ///< The resource providing the memory
+};
+
+} // namespace podio::detail
+
+#endif // PODIO_DETAIL_OBJARENA_H
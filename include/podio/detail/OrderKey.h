@@ -23,6 +23,17 @@ public:
 private:
   const void* m_orderKey;
 };
+
+/// Tag type that makes the getOrderKey functions of all datatypes and interface
+/// types available via argument dependent lookup. This is necessary for
+/// templated code that is defined before these functions are declared.
+struct OrderKeyTag {};
+
+/// Get the OrderKey of any datatype or interface type handle
+template <typename T>
+OrderKey orderKeyOf(const T& obj) {
+  return getOrderKey(obj, OrderKeyTag{});
+}
 } // namespace podio::detail
 
 #endif // PODIO_DETAIL_ORDERKEY_H
@@ -1,15 +1,74 @@
 #ifndef PODIO_DETAIL_RELATIONIOHELPERS_H
 #define PODIO_DETAIL_RELATIONIOHELPERS_H
 
+#include "podio/ICollectionProvider.h"
 #include "podio/utilities/TypeHelpers.h"
 #include <podio/CollectionBase.h>
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace podio::detail {
 
+/// Helper for resolving the collections that the ObjectIDs of a collection
+/// point to when reading it back.
+///
+/// Each distinct collectionID is requested from the ICollectionProvider only
+/// once, all further requests are served from a cache. Typically the ObjectIDs
+/// of a relation only point to very few collections, and consecutive ObjectIDs
+/// usually point to the same one, so a small vector with a shortcut for the
+/// last requested collection is enough here.
+class CollectionResolver {
+public:
+  explicit CollectionResolver(const podio::ICollectionProvider* provider) : m_provider(provider) {
+  }
+
+  /// Get the collection with the given collectionID or a nullptr if it is not
+  /// available from the provider
+  podio::CollectionBase* get(const uint32_t collectionID) {
+    if (m_last < m_resolved.size() && m_resolved[m_last].first == collectionID) {
+      return m_resolved[m_last].second;
+    }
+    for (size_t i = 0; i < m_resolved.size(); ++i) {
+      if (m_resolved[i].first == collectionID) {
+        m_last = i;
+        return m_resolved[i].second;
+      }
+    }
+
+    podio::CollectionBase* coll = nullptr;
+    if (!m_provider->get(collectionID, coll)) {
+      coll = nullptr;
+    }
+    m_last = m_resolved.size();
+    m_resolved.emplace_back(collectionID, coll);
+    return coll;
+  }
+
+  /// Get the collection with the given collectionID if it has already been
+  /// requested via get, without asking the ICollectionProvider again
+  ///
+  /// @returns The collection or a nullptr if it has not been requested before
+  ///          or if it was not available from the provider
+  podio::CollectionBase* getResolved(const uint32_t collectionID) const {
+    for (const auto& [id, coll] : m_resolved) {
+      if (id == collectionID) {
+        return coll;
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  const podio::ICollectionProvider* m_provider{nullptr};
+  std::vector<std::pair<uint32_t, podio::CollectionBase*>> m_resolved{};
+  size_t m_last{0};
+};
+
 /// Function template for handling interface types in OneToMultiRelations
 ///
 /// Effectively this function checks whether the passed collection can be
@@ -92,85 +151,117 @@ void addMultiRelation(std::vector<RelType>& relElements, const podio::Collection
   }
 }
 
-/// Function template for handling interface types in OneToOneRelations
+/// Function template for handling interface types in getRelatedObject
 ///
-/// Effectively this function checks whether the passed collection can be
-/// dynamically cast to the collection type of the concrete type and if that is
-/// true uses it to assign to the passed interface object The function on its
-/// own doesn't do anything too meaningful, it is meant to be used in a call to
-/// std::apply that goes over all the interfaced types of an interface type.
+/// Checks whether the passed collection can be dynamically cast to the
+/// collection type of the concrete type and if that is true uses it to create
+/// the interface object. Meant to be used in a call to std::apply that goes
+/// over all the interfaced types of an interface type.
 ///
 /// @tparam T The concrete type inside the interface that should be checked.
-///           This effectively is mainly used for tag-dispatch and overload
-///           selection in this context
 /// @tparam InterfaceType The interface type (that can be used to interface T)
 ///
-/// @param relation The object to which the interface object should be assigned
-///                 to
+/// @param relation The interface object that should be created
 /// @param coll The collection that holds the actual element
 /// @param id The ObjectID of the element that we are currently looking for
 template <typename T, typename InterfaceType>
-void tryAssignTo(T, std::unique_ptr<InterfaceType>& relation, const podio::CollectionBase* coll,
-                 const podio::ObjectID id) {
+void tryGetFrom(T, std::optional<InterfaceType>& relation, const podio::CollectionBase* coll,
+                const podio::ObjectID id) {
+  if (relation) {
+    return;
+  }
   if (const auto* typeColl = dynamic_cast<const typename T::collection_type*>(coll)) {
-    relation = std::make_unique<InterfaceType>((*typeColl)[id.index]);
+    relation.emplace(T((*typeColl)[id.index]));
   }
 }
 
-/// Helper function for handling interface type relations in OneToOneRelations
-///
-/// This function tries all types that are interfaced by the InterfaceType and
-/// that assigns the one that matches to the relation. The main work happens in
-/// tryAssignTo, this simply wraps everything in a std::apply over all
-/// interfaced_types.
-///
-/// @tparam InterfaceType The interface type of the Relation
-///
-/// @param relation The object to which the interface object should be assigned
-///                 to
-/// @param coll The collection that holds the actual element
-/// @param id The ObjectID of the element that we are currently looking for
-template <typename InterfaceType>
-void addInterfaceToSingleRelation(std::unique_ptr<InterfaceType>& relation, const podio::CollectionBase* coll,
-                                  const podio::ObjectID id) {
-  std::apply([&](auto... t) { (tryAssignTo(t, relation, coll, id), ...); }, typename InterfaceType::interfaced_types{});
-}
-
-/// Helper function for assigning the related object in a OneToOneRelation
-///
-/// This function does the necessary type casting of the passed collection to
-/// retrieve the desired object and also takes care of assigning the object to
-/// the passed pointer that hold it for later usage. It handles relations
-/// to regular types as well as interface types.
+/// Helper function for creating a handle to an object that is stored in a
+/// collection
 ///
-/// This functionality has been lifted from the jinja2 templates, where we now
-/// only call it, because we need a template deduction context for making if
-/// constexpr work as expected, such that we can dispatch to different
-/// implementations depending on whether the relation is to an interface type or
-/// to a regular type.
+/// This handles relations to regular types as well as interface types. For
+/// interface types the collection is checked against all interfaced types.
 ///
 /// @note It is expected that the following pre-conditions are met:
 ///       - The passed collection is valid (i.e. not a nullptr)
-///       - the collectionID of the passed collection is the same as the one in
-///         the passed ObjectID
 ///       - The collection can by casted to the relation type or any of the
 ///         interfaced types of the relation
 ///
-/// @tparam RelType The type of the OneToManyRelation
+/// @tparam RelType The type of the handle that should be created
 ///
-/// @param relation The pointer to which we should assign the related object
-///                 that is retrieved from the passed collection
 /// @param coll The collection from which the object will be obtained after the
 ///             necessary type casting
-/// @param id The ObjectID of the object that should be retrieved and added.
+/// @param id The ObjectID of the object
+///
+/// @returns A handle to the object, or an empty handle if the collection does
+///          not match any of the interfaced types of an interface type
 template <typename RelType>
-void addSingleRelation(std::unique_ptr<RelType>& relation, const podio::CollectionBase* coll,
-                       const podio::ObjectID id) {
+RelType getRelatedObject(const podio::CollectionBase* coll, const podio::ObjectID id) {
   if constexpr (podio::detail::isInterfaceType<RelType>) {
-    addInterfaceToSingleRelation(relation, coll, id);
+    std::optional<RelType> relation{};
+    std::apply([&](auto... t) { (tryGetFrom(t, relation, coll, id), ...); }, typename RelType::interfaced_types{});
+    return relation ? *relation : RelType::makeEmpty();
   } else {
     const auto* typeColl = static_cast<const typename RelType::collection_type*>(coll);
-    relation = std::make_unique<RelType>((*typeColl)[id.index]);
+    return (*typeColl)[id.index];
+  }
+}
+
+/// The type of the functions that create a handle to an object that is stored
+/// in a collection
+template <typename RelType>
+using RelatedObjectMakerT = RelType (*)(const podio::CollectionBase*, const podio::ObjectID);
+
+/// Create a (interface) handle to an object in a collection that is known to be
+/// of the collection type of T
+template <typename T, typename RelType>
+RelType getRelatedObjectAs(const podio::CollectionBase* coll, const podio::ObjectID id) {
+  const auto* typeColl = static_cast<const typename T::collection_type*>(coll);
+  return RelType(T((*typeColl)[id.index]));
+}
+
+/// Create an empty handle independent of the passed collection and ObjectID
+template <typename RelType>
+RelType makeEmptyRelatedObject(const podio::CollectionBase*, const podio::ObjectID) {
+  return RelType::makeEmpty();
+}
+
+/// Function template for handling interface types in getRelatedObjectMaker
+///
+/// Checks whether the passed collection can be dynamically cast to the
+/// collection type of the concrete type and if that is true sets the maker to
+/// the function creating an interface handle from that type. Meant to be used
+/// in a call to std::apply that goes over all the interfaced types of an
+/// interface type.
+template <typename T, typename InterfaceType>
+void tryGetMakerFor(T, RelatedObjectMakerT<InterfaceType>& maker, const podio::CollectionBase* coll) {
+  if (!maker && dynamic_cast<const typename T::collection_type*>(coll)) {
+    maker = &getRelatedObjectAs<T, InterfaceType>;
+  }
+}
+
+/// Get the function that creates handles to the objects in the passed
+/// collection
+///
+/// For interface types the concrete type of the collection is determined here
+/// once, such that creating the handles later does not need any casts that
+/// have to be checked.
+///
+/// @tparam RelType The type of the handle that should be created
+///
+/// @param coll The collection from which the objects will be obtained
+///
+/// @returns A function that creates a handle to an object in the passed
+///          collection, or one that always creates an empty handle if the
+///          collection does not match any of the interfaced types of an
+///          interface type
+template <typename RelType>
+RelatedObjectMakerT<RelType> getRelatedObjectMaker(const podio::CollectionBase* coll) {
+  if constexpr (podio::detail::isInterfaceType<RelType>) {
+    RelatedObjectMakerT<RelType> maker{nullptr};
+    std::apply([&](auto... t) { (tryGetMakerFor(t, maker, coll), ...); }, typename RelType::interfaced_types{});
+    return maker ? maker : &makeEmptyRelatedObject<RelType>;
+  } else {
+    return &getRelatedObject<RelType>;
   }
 }
 
@@ -0,0 +1,105 @@
+#ifndef PODIO_DETAIL_SINGLERELATION_H
+#define PODIO_DETAIL_SINGLERELATION_H
+
+#include "podio/detail/RelationIOHelpers.h"
+
+#include "podio/CollectionBase.h"
+#include "podio/ObjectID.h"
+
+#include <memory>
+
+namespace podio::detail {
+
+/// Storage for a single related object, as used for OneToOneRelations and for
+/// the two ends of a link.
+///
+/// Relations that are set in memory store a handle to the related object.
+/// Relations that have been read only store the ObjectID of the related object
+/// and a pointer to the collection it is stored in, such that resolving them
+/// does not need any allocations. In this case a handle is only created on
+/// access.
+///
+/// @note T can be an incomplete type where this is declared. Setting a relation
+/// to an object in a collection requires the collection type(s) of T to be
+/// complete, all other operations only require T to be complete.
+template <typename T>
+class SingleRelation {
+  /// Function to create a handle to an object in a collection
+  using MakeHandleT = podio::detail::RelatedObjectMakerT<T>;
+
+public:
+  SingleRelation() = default;
+  ~SingleRelation() = default;
+
+  SingleRelation(const SingleRelation& other) :
+      m_handle(other.m_handle ? std::make_unique<T>(*other.m_handle) : nullptr),
+      m_coll(other.m_coll),
+      m_id(other.m_id),
+      m_makeHandle(other.m_makeHandle) {
+  }
+
+  SingleRelation& operator=(const SingleRelation& other) {
+    return *this = SingleRelation(other);
+  }
+
+  SingleRelation(SingleRelation&&) = default;
+  SingleRelation& operator=(SingleRelation&&) = default;
+
+  /// Get a handle to the related object or an empty handle if this is unset
+  T get() const {
+    if (m_handle) {
+      return T(*m_handle);
+    }
+    if (m_coll) {
+      return m_makeHandle(m_coll, m_id);
+    }
+    return T::makeEmpty();
+  }
+
+  /// Get the ObjectID of the related object or an invalid ObjectID if this is
+  /// unset
+  podio::ObjectID getObjectID() const {
+    if (m_handle) {
+      return m_handle->getObjectID();
+    }
+    if (m_coll) {
+      return m_id;
+    }
+    return {podio::ObjectID::invalid, 0};
+  }
+
+  /// Relate to the passed object
+  void set(const T& value) {
+    m_handle = std::make_unique<T>(value);
+    m_coll = nullptr;
+  }
+
+  /// Relate to the object with the passed ObjectID in the passed collection
+  void set(const podio::CollectionBase* coll, const podio::ObjectID id) {
+    m_handle.reset();
+    m_coll = coll;
+    m_id = id;
+    m_makeHandle = podio::detail::getRelatedObjectMaker<T>(coll);
+  }
+
+  /// Unset this
+  void reset() {
+    m_handle.reset();
+    m_coll = nullptr;
+  }
+
+  /// Whether this relates to an object
+  explicit operator bool() const {
+    return m_handle || m_coll;
+  }
+
+private:
+  std::unique_ptr<T> m_handle{nullptr};          ///< The handle for relations that have been set in memory
+  const podio::CollectionBase* m_coll{nullptr}; ///< The collection of the object for relations that have been read
+  podio::ObjectID m_id{};                        ///< The ObjectID of the object for relations that have been read
+  MakeHandleT m_makeHandle{nullptr};             ///< Creates the handle for relations that have been read
+};
+
+} // namespace podio::detail
+
+#endif // PODIO_DETAIL_SINGLERELATION_H
@@ -2,6 +2,7 @@
 #define PODIO_UTILITIES_MAYBESHAREDPTR_H
 
 #include <atomic>
+#include <concepts>
 
 namespace podio::utils {
 
@@ -10,10 +11,48 @@ namespace detail {
   /// managed pointer and hence will be created with a control block (ownership of
   /// the managed pointer may still change later!)
   struct MarkOwnedTag {};
+
+  /// Simple control structure that controls the behavior of the
+  /// MaybeSharedPtr destructor. Keeps track of how many references of the
+  /// ControlBlock are currently still alive and whether the managed pointer
+  /// should be destructed alongside the ControlBlock, once the reference count
+  /// reaches 0.
+  struct ControlBlock {
+    std::atomic<unsigned> count{1}; ///< reference count
+    std::atomic<bool> owned{true};  ///< ownership flag for the managed pointer. true == we manage the pointer
+  };
 } // namespace detail
 
 inline constexpr auto MarkOwned [[maybe_unused]] = detail::MarkOwnedTag{};
 
+/// A reference count that can be embedded into the types that are managed by a
+/// MaybeSharedPtr, in order to avoid the separate allocation of a control block
+/// for each owning MaybeSharedPtr.
+///
+/// Types with an IntrusiveRefCount member called m_refCount are not deleted by
+/// the MaybeSharedPtr once they have been released. Instead whoever released
+/// them holds one reference, which is dropped via deleteReleased. Copies of
+/// such types start without any references.
+struct IntrusiveRefCount {
+  IntrusiveRefCount() = default;
+  IntrusiveRefCount(const IntrusiveRefCount&) {
+  }
+  IntrusiveRefCount& operator=(const IntrusiveRefCount&) {
+    return *this;
+  }
+  ~IntrusiveRefCount() = default;
+
+  detail::ControlBlock ctrlBlock{0, true}; ///< The embedded control block
+};
+
+namespace detail {
+  /// Concept for types that carry their reference count themselves
+  template <typename T>
+  concept HasIntrusiveRefCount = requires(T* p) {
+    { p->m_refCount } -> std::same_as<IntrusiveRefCount&>;
+  };
+} // namespace detail
+
 /// "Semi-smart" pointer class for pointers that at some point during their
 /// lifetime might hand over management to another entity. E.g. Objects that
 /// are added to a collection will hand over the management of their Obj* to
@@ -25,6 +64,11 @@ inline constexpr auto MarkOwned [[maybe_unused]] = detail::MarkOwnedTag{};
 ///   gracefully destruct, even if they are at this point merely an "empty husk"
 /// The MaybeSharedPtr achieves this by having an optional control block that
 /// controls the lifetime of itself and potentially the managed Obj*.
+///
+/// If the managed type has an IntrusiveRefCount the control block is not
+/// allocated separately. Since in this case the control block dies with the
+/// managed Obj*, releasing the pointer hands over a reference instead of
+/// the ownership, and the Obj* is deleted once the last reference is gone.
 template <typename T>
 class MaybeSharedPtr {
 public:
@@ -37,7 +81,13 @@ public:
   }
 
   /// Constructor from a raw pointer assuming ownership in the process
-  explicit MaybeSharedPtr(T* p, detail::MarkOwnedTag) : m_ptr(p), m_ctrlBlock(new ControlBlock()) {
+  explicit MaybeSharedPtr(T* p, detail::MarkOwnedTag) : m_ptr(p) {
+    if constexpr (detail::HasIntrusiveRefCount<T>) {
+      m_ctrlBlock = &p->m_refCount.ctrlBlock;
+      m_ctrlBlock->count++;
+    } else {
+      m_ctrlBlock = new ControlBlock();
+    }
   }
 
   /// Copy constructor
@@ -63,13 +113,19 @@ public:
     // Only if we have a control block, do we assume that we have any
     // responsibility in cleaning things up
     if (m_ctrlBlock && --m_ctrlBlock->count == 0) {
-      // When the reference count reaches 0 we have to clean up control block in
-      // any case, but first we have to find out whether we also need to clean
-      // up the "managed" pointer
-      if (m_ctrlBlock->owned) {
+      if constexpr (detail::HasIntrusiveRefCount<T>) {
+        // Whoever the pointer has been released to holds a reference as well,
+        // so we are the last ones in any case
         delete m_ptr;
+      } else {
+        // When the reference count reaches 0 we have to clean up control block
+        // in any case, but first we have to find out whether we also need to
+        // clean up the "managed" pointer
+        if (m_ctrlBlock->owned) {
+          delete m_ptr;
+        }
+        delete m_ctrlBlock;
       }
-      delete m_ctrlBlock;
     }
   }
 
@@ -80,10 +136,20 @@ public:
   }
 
   /// Get a raw pointer to the managed pointer and assume ownership.
+  ///
+  /// @note For types with an IntrusiveRefCount the caller takes over a
+  /// reference instead and has to use deleteReleased to get rid of the pointer
   T* release() {
     if (m_ctrlBlock) {
-      // From now on we only need to keep track of the control block
-      m_ctrlBlock->owned = false;
+      if constexpr (detail::HasIntrusiveRefCount<T>) {
+        // Only the first release hands over a reference
+        if (m_ctrlBlock->owned.exchange(false)) {
+          m_ctrlBlock->count++;
+        }
+      } else {
+        // From now on we only need to keep track of the control block
+        m_ctrlBlock->owned = false;
+      }
     }
     return m_ptr;
   }
@@ -125,15 +191,7 @@ public:
 #undef DECLARE_COMPARISON_OPERATOR
 
 private:
-  /// Simple control structure that controls the behavior of the
-  /// MaybeSharedPtr destructor. Keeps track of how many references of the
-  /// ControlBlock are currently still alive and whether the managed pointer
-  /// should be destructed alongside the ControlBlock, once the reference count
-  /// reaches 0.
-  struct ControlBlock {
-    std::atomic<unsigned> count{1}; ///< reference count
-    std::atomic<bool> owned{true};  ///< ownership flag for the managed pointer. true == we manage the pointer
-  };
+  using ControlBlock = detail::ControlBlock;
 
   T* m_ptr{nullptr};
   ControlBlock* m_ctrlBlock{nullptr};
@@ -158,6 +216,52 @@ DEFINE_COMPARISON_OPERATOR(!=)
 DEFINE_COMPARISON_OPERATOR(<)
 #undef DEFINE_COMPARISON_OPERATOR
 
+/// Delete a pointer that might have been obtained via MaybeSharedPtr::release
+///
+/// For types with an IntrusiveRefCount this only drops the reference that has
+/// been handed over by release, and the pointer is only deleted if there are no
+/// MaybeSharedPtrs left that manage it.
+template <typename T>
+void deleteReleased(T* ptr) {
+  if constexpr (detail::HasIntrusiveRefCount<T>) {
+    // If there are no references there have never been any owning
+    // MaybeSharedPtrs and none can be created any longer
+    auto& ctrlBlock = ptr->m_refCount.ctrlBlock;
+    if (ctrlBlock.count.load() == 0 || --ctrlBlock.count == 0) {
+      delete ptr;
+    }
+  } else {
+    delete ptr;
+  }
+}
+
+/// Hand a pointer that has been obtained via MaybeSharedPtr::release back to
+/// the MaybeSharedPtrs that still manage it, as if it had never been released.
+///
+/// This is only possible for types with an IntrusiveRefCount.
+///
+/// @returns true if the pointer has been handed back, false if there are no
+///          MaybeSharedPtrs left that manage it. In the latter case the pointer
+///          still has to be cleaned up via deleteReleased
+template <typename T>
+bool handBackReleased(T* ptr) {
+  if constexpr (detail::HasIntrusiveRefCount<T>) {
+    auto& ctrlBlock = ptr->m_refCount.ctrlBlock;
+    // One of the references is the one that has been handed over by release
+    auto count = ctrlBlock.count.load();
+    while (count > 1) {
+      // Make the next release hand over a reference again
+      ctrlBlock.owned = true;
+      if (ctrlBlock.count.compare_exchange_weak(count, count - 1)) {
+        return true;
+      }
+    }
+    return false;
+  } else {
+    return false;
+  }
+}
+
 } // namespace podio::utils
 
 #endif // PODIO_UTILITIES_MAYBESHAREDPTR_H
@@ -4,6 +4,7 @@
 #include "podio/podioVersion.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -14,7 +15,9 @@ namespace podio {
 /// Common base class for podio reader classes providing the shared members and
 /// functionality related to the file version and the datamodel definitions.
 ///
-/// The population of the members is left to the derived reader classes.
+/// The population of the members is left to the derived reader classes. The
+/// datamodel definitions are immutable once they have been read and can be
+/// shared between several readers of the same file(s).
 class ReaderCommon {
 public:
   /// Get the build version of podio that has been used to write the current
@@ -33,7 +36,7 @@ public:
   /// @returns The (build) version of the datamodel if available or an empty
   ///          optional
   std::optional<podio::version::Version> currentFileVersion(std::string_view name) const {
-    return m_datamodelHolder.getDatamodelVersion(name);
+    return m_datamodelHolder->getDatamodelVersion(name);
   }
 
   /// Get the datamodel definition for the given name
@@ -42,14 +45,14 @@ public:
   ///
   /// @returns The high level definition of the datamodel in JSON format
   const std::string_view getDatamodelDefinition(std::string_view name) const {
-    return m_datamodelHolder.getDatamodelDefinition(name);
+    return m_datamodelHolder->getDatamodelDefinition(name);
   }
 
   /// Get all names of the datamodels that are available from this reader
   ///
   /// @returns The names of the datamodels
   std::vector<std::string> getAvailableDatamodels() const {
-    return m_datamodelHolder.getAvailableDatamodels();
+    return m_datamodelHolder->getAvailableDatamodels();
   }
 
   /// Get the names of all the available Frame categories in the current file(s).
@@ -60,8 +63,16 @@ public:
   }
 
 protected:
+  /// Take over the file version, the datamodel definitions and the available
+  /// categories from another reader of the same file(s) instead of reading them
+  void shareMetadata(const ReaderCommon& other) {
+    m_fileVersion = other.m_fileVersion;
+    m_datamodelHolder = other.m_datamodelHolder;
+    m_availableCategories = other.m_availableCategories;
+  }
+
   podio::version::Version m_fileVersion{};
-  DatamodelDefinitionHolder m_datamodelHolder{};
+  std::shared_ptr<const DatamodelDefinitionHolder> m_datamodelHolder{std::make_shared<DatamodelDefinitionHolder>()};
   std::vector<std::string> m_availableCategories{};
 };
 
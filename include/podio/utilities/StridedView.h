@@ -0,0 +1,156 @@
+#ifndef PODIO_UTILITIES_STRIDEDVIEW_H
+#define PODIO_UTILITIES_STRIDEDVIEW_H
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+namespace podio {
+
+/// A non-owning, read-only view of one member of all elements of a contiguous
+/// range of structs.
+///
+/// The view simply steps through the underlying memory with the size of the
+/// struct as stride, i.e. no copies are made and nothing is allocated. Views
+/// for members of members (e.g. a field of a component) can be obtained via
+/// member().
+///
+/// @note The view is only valid as long as the underlying range is alive and
+/// not modified.
+///
+/// @tparam T The type of the member that is viewed
+template <typename T>
+class StridedView {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const T&;
+  using pointer = const T*;
+
+  /// Random access iterator for the StridedView
+  class iterator {
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    iterator() = default;
+    iterator(const std::byte* ptr, size_type stride) : m_ptr(ptr), m_stride(stride) {
+    }
+
+    reference operator*() const {
+      return *reinterpret_cast<pointer>(m_ptr);
+    }
+    pointer operator->() const {
+      return reinterpret_cast<pointer>(m_ptr);
+    }
+    reference operator[](difference_type n) const {
+      return *(*this + n);
+    }
+
+    iterator& operator++() {
+      m_ptr += m_stride;
+      return *this;
+    }
+    iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    iterator& operator--() {
+      m_ptr -= m_stride;
+      return *this;
+    }
+    iterator operator--(int) {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+    iterator& operator+=(difference_type n) {
+      m_ptr += n * static_cast<difference_type>(m_stride);
+      return *this;
+    }
+    iterator& operator-=(difference_type n) {
+      return *this += -n;
+    }
+
+    friend iterator operator+(iterator it, difference_type n) {
+      return it += n;
+    }
+    friend iterator operator+(difference_type n, iterator it) {
+      return it += n;
+    }
+    friend iterator operator-(iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const iterator& lhs, const iterator& rhs) {
+      return lhs.m_stride == 0 ? 0 : (lhs.m_ptr - rhs.m_ptr) / static_cast<difference_type>(lhs.m_stride);
+    }
+
+    friend bool operator==(const iterator& lhs, const iterator& rhs) {
+      return lhs.m_ptr == rhs.m_ptr;
+    }
+    friend auto operator<=>(const iterator& lhs, const iterator& rhs) {
+      return std::compare_three_way{}(lhs.m_ptr, rhs.m_ptr);
+    }
+
+  private:
+    const std::byte* m_ptr{nullptr};
+    size_type m_stride{0};
+  };
+  using const_iterator = iterator;
+
+  StridedView() = default;
+
+  /// Create a view with size elements starting at first and each subsequent
+  /// element stride bytes after the previous one
+  StridedView(const T* first, size_type size, size_type stride) :
+      m_first(reinterpret_cast<const std::byte*>(first)), m_size(size), m_stride(stride) {
+  }
+
+  /// Create a view of a member of all elements of a contiguous range
+  template <typename S>
+  StridedView(std::span<const S> data, const T S::*member) :
+      StridedView(data.empty() ? nullptr : &(data.front().*member), data.size(), sizeof(S)) {
+  }
+
+  /// Get a view of a member of the viewed elements
+  template <typename U, typename S = T>
+    requires std::is_class_v<S>
+  StridedView<U> member(const U S::*mem) const {
+    return {m_size == 0 ? nullptr : &((*this)[0].*mem), m_size, m_stride};
+  }
+
+  reference operator[](size_type i) const {
+    return *reinterpret_cast<pointer>(m_first + i * m_stride);
+  }
+
+  size_type size() const {
+    return m_size;
+  }
+  bool empty() const {
+    return m_size == 0;
+  }
+
+  iterator begin() const {
+    return iterator(m_first, m_stride);
+  }
+  iterator end() const {
+    return iterator(m_first + m_size * m_stride, m_stride);
+  }
+
+private:
+  const std::byte* m_first{nullptr}; ///< The first viewed element
+  size_type m_size{0};               ///< The number of viewed elements
+  size_type m_stride{0};             ///< The distance between two elements in bytes
+};
+
+} // namespace podio
+
+#endif // PODIO_UTILITIES_STRIDEDVIEW_H
@@ -545,6 +545,8 @@ class CPPClassGenerator(ClassGeneratorBaseMixin):
 
         datatype["includes_coll_cc"] = self._sort_includes(includes_cc)
         datatype["includes_coll_data"] = self._sort_includes(includes)
+        datatype["use_obj_arena"] = self.datamodel.options["useObjArena"]
+        datatype["intrusive_ref_count"] = self.datamodel.options["intrusiveRefCount"]
 
         # the ostream operator needs a bit of help from the python side in the form
         # of some pre processing but also in the form of formatting, both are done
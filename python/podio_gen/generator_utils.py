@@ -356,6 +356,10 @@ class DataModel:  # pylint: disable=too-few-public-methods
             "exposePODMembers": True,
             # use subfolder when including package header files
             "includeSubfolder": False,
+            # allocate the Objs of a collection from a per-collection arena?
+            "useObjArena": False,
+            # embed the reference count of free-standing objects into the Objs?
+            "intrusiveRefCount": False,
         }
         self.schema_version = schema_version
         self.components = components or {}
@@ -463,6 +463,10 @@ class PodioConfigReader:
         "exposePODMembers": True,
         # use subfolder when including package header files
         "includeSubfolder": False,
+        # allocate the Objs of a collection from a per-collection arena?
+        "useObjArena": False,
+        # embed the reference count of free-standing objects into the Objs?
+        "intrusiveRefCount": False,
     }
 
     @staticmethod
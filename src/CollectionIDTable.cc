@@ -10,34 +10,45 @@ namespace podio {
 
 CollectionIDTable::CollectionIDTable(std::vector<uint32_t>&& ids, std::vector<std::string>&& names) :
     m_collectionIDs(std::move(ids)), m_names(std::move(names)) {
+  buildIndex();
 }
 
 CollectionIDTable::CollectionIDTable(const std::vector<uint32_t>& ids, const std::vector<std::string>& names) :
     m_collectionIDs(ids), m_names(names) {
+  buildIndex();
+}
+
+void CollectionIDTable::buildIndex() {
+  const auto nEntries = std::min(m_collectionIDs.size(), m_names.size());
+  m_idIndex.clear();
+  m_nameIndex.clear();
+  m_idIndex.reserve(nEntries);
+  m_nameIndex.reserve(nEntries);
+  // Use try_emplace to keep the first occurrence, in line with a linear search
+  for (size_t i = 0; i < nEntries; ++i) {
+    m_idIndex.try_emplace(m_collectionIDs[i], i);
+    m_nameIndex.try_emplace(m_names[i], i);
+  }
 }
 
 std::optional<const std::string> CollectionIDTable::name(uint32_t ID) const {
-  std::lock_guard<std::mutex> lock{*m_mutex};
-  const auto result = std::ranges::find(m_collectionIDs, ID);
-  const auto index = std::distance(m_collectionIDs.begin(), result);
-  if (index >= static_cast<ptrdiff_t>(m_names.size())) {
-    return std::nullopt;
+  std::shared_lock lock{*m_mutex};
+  if (const auto it = m_idIndex.find(ID); it != m_idIndex.end()) {
+    return m_names[it->second];
   }
-  return m_names[index];
+  return std::nullopt;
 }
 
 std::optional<uint32_t> CollectionIDTable::collectionID(const std::string& name) const {
-  std::lock_guard<std::mutex> lock{*m_mutex};
-  const auto result = std::ranges::find(m_names, name);
-  const auto index = std::distance(m_names.begin(), result);
-  if (index >= static_cast<ptrdiff_t>(m_collectionIDs.size())) {
-    return std::nullopt;
+  std::shared_lock lock{*m_mutex};
+  if (const auto it = m_nameIndex.find(name); it != m_nameIndex.end()) {
+    return m_collectionIDs[it->second];
   }
-  return m_collectionIDs[index];
+  return std::nullopt;
 }
 
 void CollectionIDTable::print() const {
-  std::lock_guard<std::mutex> lock{*m_mutex};
+  std::shared_lock lock{*m_mutex};
   std::cout << "CollectionIDTable" << std::endl;
   for (unsigned i = 0; i < m_names.size(); ++i) {
     std::cout << "\t" << m_names[i] << " : " << m_collectionIDs[i] << std::endl;
@@ -45,25 +56,27 @@ void CollectionIDTable::print() const {
 }
 
 bool CollectionIDTable::present(const std::string& name) const {
-  return collectionID(name).has_value();
+  std::shared_lock lock{*m_mutex};
+  return m_nameIndex.contains(name);
 }
 
 bool CollectionIDTable::present(uint32_t collectionID) const {
-  return name(collectionID).has_value();
+  std::shared_lock lock{*m_mutex};
+  return m_idIndex.contains(collectionID);
 }
 
 uint32_t CollectionIDTable::add(const std::string& name) {
-  std::lock_guard<std::mutex> lock{*m_mutex};
-  const auto result = std::ranges::find(m_names, name);
-  uint32_t ID = 0;
-  if (result == m_names.end()) {
-    m_names.emplace_back(name);
-    MurmurHash3_x86_32(name.c_str(), name.size(), 0, &ID);
-    m_collectionIDs.emplace_back(ID);
-  } else {
-    const auto index = std::distance(m_names.begin(), result);
-    ID = m_collectionIDs[index];
+  std::lock_guard lock{*m_mutex};
+  if (const auto it = m_nameIndex.find(name); it != m_nameIndex.end()) {
+    return m_collectionIDs[it->second];
   }
+  uint32_t ID = 0;
+  MurmurHash3_x86_32(name.c_str(), name.size(), 0, &ID);
+  const auto index = m_names.size();
+  m_names.emplace_back(name);
+  m_collectionIDs.emplace_back(ID);
+  m_nameIndex.try_emplace(name, index);
+  m_idIndex.try_emplace(ID, index);
   return ID;
 }
 
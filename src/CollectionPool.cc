@@ -0,0 +1,95 @@
+#include "podio/CollectionPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace podio {
+
+namespace {
+  /// A type erased buffer that deletes itself properly
+  using PooledBuffer = std::unique_ptr<void, void (*)(void*)>;
+
+  struct PoolStorage {
+    std::atomic<bool> enabled{false};
+    size_t maxBuffersPerType{64};
+    std::mutex mtx{};
+    std::unordered_map<std::type_index, std::vector<PooledBuffer>> buffers{};
+  };
+
+  PoolStorage& storage() {
+    static PoolStorage pool;
+    return pool;
+  }
+} // namespace
+
+void CollectionPool::enable(bool enabled) {
+  storage().enabled = enabled;
+  if (!enabled) {
+    clear();
+  }
+}
+
+bool CollectionPool::isEnabled() {
+  return storage().enabled.load(std::memory_order_relaxed);
+}
+
+void CollectionPool::setMaxBuffersPerType(size_t maxBuffers) {
+  auto& pool = storage();
+  std::lock_guard lock{pool.mtx};
+  pool.maxBuffersPerType = maxBuffers;
+  for (auto& [_, buffers] : pool.buffers) {
+    if (buffers.size() > maxBuffers) {
+      buffers.erase(buffers.begin() + maxBuffers, buffers.end());
+    }
+  }
+}
+
+void CollectionPool::clear() {
+  // Delete the buffers outside of the lock
+  decltype(PoolStorage::buffers) buffers;
+  {
+    auto& pool = storage();
+    std::lock_guard lock{pool.mtx};
+    buffers.swap(pool.buffers);
+  }
+}
+
+size_t CollectionPool::size() {
+  auto& pool = storage();
+  std::lock_guard lock{pool.mtx};
+  size_t total = 0;
+  for (const auto& [_, buffers] : pool.buffers) {
+    total += buffers.size();
+  }
+  return total;
+}
+
+void* CollectionPool::acquireImpl(std::type_index type) {
+  auto& pool = storage();
+  if (!pool.enabled.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  std::lock_guard lock{pool.mtx};
+  if (auto it = pool.buffers.find(type); it != pool.buffers.end() && !it->second.empty()) {
+    auto buffer = std::move(it->second.back());
+    it->second.pop_back();
+    return buffer.release();
+  }
+  return nullptr;
+}
+
+void CollectionPool::releaseImpl(std::type_index type, void* buffer, DeleterT deleter) {
+  auto pooled = PooledBuffer(buffer, deleter);
+  auto& pool = storage();
+  if (!pool.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard lock{pool.mtx};
+  auto& buffers = pool.buffers[type];
+  if (buffers.size() < pool.maxBuffersPerType) {
+    buffers.emplace_back(std::move(pooled));
+  }
+}
+
+} // namespace podio
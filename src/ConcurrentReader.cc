@@ -0,0 +1,86 @@
+#include "podio/ConcurrentReader.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace podio {
+
+ConcurrentReader::ConcurrentReader(const std::vector<std::string>& filenames, size_t maxReaders) :
+    ConcurrentReader(podio::makeReader(filenames), maxReaders) {
+}
+
+ConcurrentReader::ConcurrentReader(podio::Reader reader, size_t maxReaders) :
+    m_reader(std::move(reader)),
+    m_maxReaders(maxReaders > 0 ? maxReaders : std::max(1u, std::thread::hardware_concurrency())) {
+  // Cache the number of entries, since getting them is not necessarily thread
+  // safe for all backends
+  for (const auto category : m_reader.getAvailableCategories()) {
+    m_entries.emplace(category, m_reader.getEntries(category));
+  }
+}
+
+podio::Frame ConcurrentReader::readFrame(std::string_view name, size_t index,
+                                         const std::vector<std::string>& collsToRead) {
+  auto reader = acquireReader();
+  try {
+    auto frame = reader->readFrame(name, index, collsToRead);
+    releaseReader(std::move(reader));
+    return frame;
+  } catch (...) {
+    releaseReader(std::move(reader));
+    throw;
+  }
+}
+
+size_t ConcurrentReader::getEntries(std::string_view name) const {
+  if (const auto it = m_entries.find(name); it != m_entries.end()) {
+    return it->second;
+  }
+  return 0;
+}
+
+size_t ConcurrentReader::getNReaders() const {
+  std::lock_guard lock{m_poolMtx};
+  return m_nReaders;
+}
+
+std::unique_ptr<podio::Reader> ConcurrentReader::acquireReader() {
+  {
+    std::unique_lock lock{m_poolMtx};
+    m_poolCond.wait(lock, [this]() { return !m_idleReaders.empty() || m_nReaders < m_maxReaders; });
+    if (!m_idleReaders.empty()) {
+      auto reader = std::move(m_idleReaders.back());
+      m_idleReaders.pop_back();
+      return reader;
+    }
+    // Reserve the slot for the new reader before releasing the lock
+    ++m_nReaders;
+  }
+
+  // Opening a reader can take a while, so this happens without holding the
+  // lock of the pool. Opening a shared reader can still initialize some
+  // metadata lazily in the original reader, so it needs its own lock
+  try {
+    std::lock_guard lock{m_openMtx};
+    return std::make_unique<podio::Reader>(m_reader.openShared());
+  } catch (...) {
+    {
+      std::lock_guard lock{m_poolMtx};
+      --m_nReaders;
+    }
+    m_poolCond.notify_one();
+    throw;
+  }
+}
+
+void ConcurrentReader::releaseReader(std::unique_ptr<podio::Reader> reader) {
+  {
+    std::lock_guard lock{m_poolMtx};
+    m_idleReaders.emplace_back(std::move(reader));
+  }
+  m_poolCond.notify_one();
+}
+
+} // namespace podio
@@ -35,9 +35,9 @@ void DataSource::SetupInput(int nEvents, const std::vector<std::string>& collsTo
   // Create probing frame
   podio::Frame frame;
   unsigned int nEventsInFiles = 0;
-  auto podioReader = podio::makeReader(m_filePathList);
-  nEventsInFiles = podioReader.getEntries(podio::Category::Event);
-  frame = podioReader.readFrame(podio::Category::Event, 0, collsToRead);
+  m_probingReader = std::make_unique<podio::Reader>(podio::makeReader(m_filePathList));
+  nEventsInFiles = m_probingReader->getEntries(podio::Category::Event);
+  frame = m_probingReader->readFrame(podio::Category::Event, 0, collsToRead);
 
   // Determine over how many events to run
   if (nEventsInFiles == 0) {
@@ -83,9 +83,9 @@ void DataSource::SetNSlots(unsigned int nSlots) {
   // Initialize set of addresses needed
   m_Collections.resize(m_columnNames.size(), std::vector<const podio::CollectionBase*>(m_nSlots, nullptr));
 
-  // Initialize podio readers
+  // Initialize podio readers, sharing the metadata of the probing reader
   for (size_t i = 0; i < m_nSlots; ++i) {
-    m_podioReaders.emplace_back(std::make_unique<podio::Reader>(podio::makeReader(m_filePathList)));
+    m_podioReaders.emplace_back(std::make_unique<podio::Reader>(m_probingReader->openShared()));
   }
 
   for (size_t i = 0; i < m_nSlots; ++i) {
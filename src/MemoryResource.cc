@@ -0,0 +1,21 @@
+#include "podio/MemoryResource.h"
+
+namespace podio {
+
+namespace {
+  thread_local std::pmr::memory_resource* currentResource = nullptr;
+} // namespace
+
+std::pmr::memory_resource* currentMemoryResource() {
+  return currentResource;
+}
+
+MemoryResourceScope::MemoryResourceScope(std::pmr::memory_resource* resource) : m_previous(currentResource) {
+  currentResource = resource;
+}
+
+MemoryResourceScope::~MemoryResourceScope() {
+  currentResource = m_previous;
+}
+
+} // namespace podio
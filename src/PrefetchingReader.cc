@@ -0,0 +1,85 @@
+#include "podio/PrefetchingReader.h"
+
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace podio {
+
+PrefetchingReader::PrefetchingReader(podio::Reader&& reader, std::string_view category, size_t depth,
+                                     const std::vector<std::string>& collsToRead, bool unpack) :
+    m_reader(std::move(reader)),
+    m_category(category),
+    m_collsToRead(collsToRead),
+    m_depth(depth),
+    m_unpack(unpack),
+    m_entries(m_reader.getEntries(category)) {
+  if (m_depth == 0) {
+    throw std::invalid_argument("The PrefetchingReader needs to read ahead at least one Frame");
+  }
+  m_readThread = std::thread(&PrefetchingReader::readAhead, this);
+}
+
+PrefetchingReader::~PrefetchingReader() {
+  {
+    std::lock_guard lock{m_queueMtx};
+    m_stop = true;
+  }
+  m_queueCond.notify_all();
+  m_readThread.join();
+}
+
+std::future<podio::Frame> PrefetchingReader::readNextFrameAsync() {
+  std::unique_lock lock{m_queueMtx};
+  m_queueCond.wait(lock, [this]() { return !m_queue.empty() || m_finished; });
+  if (m_queue.empty()) {
+    std::promise<podio::Frame> noFrame;
+    noFrame.set_exception(std::make_exception_ptr(
+        std::runtime_error("Failed reading category " + m_category + " (reading beyond bounds?)")));
+    return noFrame.get_future();
+  }
+
+  auto nextFrame = std::move(m_queue.front());
+  m_queue.pop_front();
+  lock.unlock();
+  // There is space in the queue again
+  m_queueCond.notify_all();
+  return nextFrame;
+}
+
+void PrefetchingReader::readAhead() {
+  for (size_t i = 0; i < m_entries; ++i) {
+    std::promise<podio::Frame> frame;
+    {
+      std::unique_lock lock{m_queueMtx};
+      m_queueCond.wait(lock, [this]() { return m_stop || m_queue.size() < m_depth; });
+      if (m_stop) {
+        break;
+      }
+      // Put the future into the queue already here, such that it can be handed
+      // out while the Frame is still being read
+      m_queue.push_back(frame.get_future());
+    }
+    m_queueCond.notify_all();
+
+    try {
+      auto readFrame = m_reader.readNextFrame(m_category, m_collsToRead);
+      if (m_unpack) {
+        readFrame.unpackAll(false);
+      }
+      frame.set_value(std::move(readFrame));
+    } catch (...) {
+      // Reading any further does not make sense after a failure
+      frame.set_exception(std::current_exception());
+      break;
+    }
+  }
+
+  {
+    std::lock_guard lock{m_queueMtx};
+    m_finished = true;
+  }
+  m_queueCond.notify_all();
+}
+
+} // namespace podio
@@ -55,7 +55,7 @@ bool RNTupleReader::initCategory(std::string_view category) {
   auto collInfo = m_metadata_readers[filename]->GetView<std::vector<root_utils::CollectionWriteInfo>>(
       {root_utils::collInfoName(category)});
 
-  m_collectionInfo[category] = collInfo(0);
+  m_collectionInfo[category] = std::make_shared<const std::vector<root_utils::CollectionWriteInfo>>(collInfo(0));
   m_idTables[category] = root_utils::makeCollIdTable(collInfo(0));
 
   return true;
@@ -90,12 +90,37 @@ void RNTupleReader::openFiles(const std::vector<std::string>& filenames) {
     } catch (const RException&) {
     }
   }
-  m_datamodelHolder = DatamodelDefinitionHolder(std::move(edm), std::move(edmVersions));
+  m_datamodelHolder = std::make_shared<DatamodelDefinitionHolder>(std::move(edm), std::move(edmVersions));
 
   auto availableCategoriesField = m_metadata->GetView<std::vector<std::string>>(root_utils::availableCategories);
   m_availableCategories = availableCategoriesField(0);
   std::ranges::sort(m_availableCategories);
 
+  openCategoryReaders();
+}
+
+std::unique_ptr<RNTupleReader> RNTupleReader::openShared() {
+  auto reader = std::make_unique<RNTupleReader>();
+  reader->shareMetadata(*this);
+  reader->m_filenames = m_filenames;
+
+  for (const auto& category : m_availableCategories) {
+    if (m_collectionInfo.find(category) == m_collectionInfo.end()) {
+      initCategory(category);
+    }
+  }
+  // The keys of the maps have to point into the available categories of the
+  // new reader
+  for (const auto& category : reader->m_availableCategories) {
+    reader->m_collectionInfo[category] = m_collectionInfo.at(category);
+    reader->m_idTables[category] = m_idTables.at(category);
+  }
+
+  reader->openCategoryReaders();
+  return reader;
+}
+
+void RNTupleReader::openCategoryReaders() {
   // Pre-fill the entries map
   for (const auto& category : m_availableCategories) {
     m_readerEntries[category].reserve(m_filenames.size() + 1);
@@ -146,7 +171,7 @@ std::unique_ptr<ROOTFrameData> RNTupleReader::readEntry(std::string_view categor
     return nullptr;
   }
 
-  const auto& collInfo = m_collectionInfo[category];
+  const auto& collInfo = *m_collectionInfo[category];
   // Make sure to not silently ignore non-existant but requested collections
   if (!collsToRead.empty()) {
     for (const auto& name : collsToRead) {
@@ -12,6 +12,11 @@
 
 #include <ROOT/RVersion.hxx>
 
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
 // Adjust for the API stabilization of RNTuple
 // https://github.com/root-project/root/pull/17804
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6, 35, 0)
@@ -24,8 +29,88 @@ using ROOT::Experimental::RNTupleWriteOptions;
 
 namespace podio {
 
-RNTupleWriter::RNTupleWriter(const std::string& filename) :
-    m_file(new TFile(filename.c_str(), "RECREATE", "data file")) {
+namespace {
+  /// Get the collections that should be written from the Frame
+  std::vector<root_utils::StoreCollection> getCollectionsToWrite(const podio::Frame& frame,
+                                                                 const std::vector<std::string>& names,
+                                                                 std::string_view category) {
+    std::vector<root_utils::StoreCollection> collections;
+    collections.reserve(names.size());
+    for (const auto& name : names) {
+      const auto* coll = frame.getCollectionForWrite(name);
+      if (!coll) {
+        // Make sure all collections that we want to write are actually available
+        // NOLINTNEXTLINE(performance-inefficient-string-concatenation)
+        throw std::runtime_error("Collection '" + name + "' in category '" + std::string(category) +
+                                 "' is not available in Frame");
+      }
+
+      collections.emplace_back(name, const_cast<podio::CollectionBase*>(coll));
+    }
+    return collections;
+  }
+
+  /// Set the ROOT compression setting (algorithm * 100 + level) for the
+  /// options. Without an explicit algorithm the default of RNTuple is kept and
+  /// only its level is replaced if one is given
+  void setCompression(RNTupleWriteOptions& writeOptions, const WriterOptions& options) {
+    using Compression = WriterOptions::Compression;
+    using ROOT::RCompressionSetting;
+    int setting = writeOptions.GetCompression();
+    switch (options.compression) {
+    case Compression::None:
+      writeOptions.SetCompression(0);
+      return;
+    case Compression::Default:
+      if (!options.compressionLevel) {
+        return;
+      }
+      break;
+    case Compression::ZLIB:
+      setting = RCompressionSetting::EDefaults::kDefaultZLIB;
+      break;
+    case Compression::LZMA:
+      setting = RCompressionSetting::EDefaults::kDefaultLZMA;
+      break;
+    case Compression::LZ4:
+      setting = RCompressionSetting::EDefaults::kDefaultLZ4;
+      break;
+    case Compression::ZSTD:
+      setting = RCompressionSetting::EDefaults::kDefaultZSTD;
+      break;
+    }
+    if (options.compressionLevel) {
+      setting = (setting / 100) * 100 + *options.compressionLevel;
+    }
+    writeOptions.SetCompression(setting);
+  }
+
+  /// Translate the writer options into the RNTuple write options
+  RNTupleWriteOptions getWriteOptions(const WriterOptions& options) {
+    RNTupleWriteOptions writeOptions;
+    setCompression(writeOptions, options);
+    if (options.approxZippedClusterSize) {
+      writeOptions.SetApproxZippedClusterSize(*options.approxZippedClusterSize);
+    }
+    if (options.maxUnzippedClusterSize) {
+      writeOptions.SetMaxUnzippedClusterSize(*options.maxUnzippedClusterSize);
+    }
+    if (options.maxUnzippedPageSize) {
+      writeOptions.SetMaxUnzippedPageSize(*options.maxUnzippedPageSize);
+    }
+    if (options.useBufferedWrite) {
+      writeOptions.SetUseBufferedWrite(*options.useBufferedWrite);
+    }
+    return writeOptions;
+  }
+} // namespace
+
+RNTupleWriter::RNTupleWriter(const std::string& filename, const WriterOptions& options) : m_options(options) {
+  if (options.compressionLevel && (*options.compressionLevel < 1 || *options.compressionLevel > 9)) {
+    throw std::invalid_argument("Invalid compression level " + std::to_string(*options.compressionLevel) +
+                                ", has to be in [1, 9]");
+  }
+  m_file = std::make_unique<TFile>(filename.c_str(), "RECREATE", "data file");
 }
 
 RNTupleWriter::~RNTupleWriter() {
@@ -33,23 +118,23 @@ RNTupleWriter::~RNTupleWriter() {
 }
 
 template <typename T>
-root_utils::ParamStorage<T>& RNTupleWriter::getParamStorage(CategoryInfo& catInfo) {
+root_utils::ParamStorage<T>& RNTupleWriter::getParamStorage(ParamStorages& storages) {
   if constexpr (std::is_same_v<T, int>) {
-    return catInfo.intParams;
+    return storages.intParams;
   } else if constexpr (std::is_same_v<T, float>) {
-    return catInfo.floatParams;
+    return storages.floatParams;
   } else if constexpr (std::is_same_v<T, double>) {
-    return catInfo.doubleParams;
+    return storages.doubleParams;
   } else if constexpr (std::is_same_v<T, std::string>) {
-    return catInfo.stringParams;
+    return storages.stringParams;
   } else {
     throw std::runtime_error("Unknown type");
   }
 }
 
 template <typename T>
-void RNTupleWriter::fillParams(const GenericParameters& params, CategoryInfo& catInfo, root_compat::REntry* entry) {
-  auto& paramStorage = getParamStorage<T>(catInfo);
+void RNTupleWriter::fillParams(const GenericParameters& params, ParamStorages& storages, root_compat::REntry* entry) {
+  auto& paramStorage = getParamStorage<T>(storages);
   paramStorage = params.getKeysAndValues<T>();
   entry->BindRawPtr(root_utils::getGPKeyName<T>(), &paramStorage.keys);
   entry->BindRawPtr(root_utils::getGPValueName<T>(), &paramStorage.values);
@@ -61,54 +146,22 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, std::string_view categ
 
 void RNTupleWriter::writeFrame(const podio::Frame& frame, std::string_view category,
                                const std::vector<std::string>& collsToWrite) {
-  auto& catInfo = getCategoryInfo(category);
-
-  // Use the writer as proxy to check whether this category has been initialized
-  // already and do so if not
-  const bool new_category = catInfo.writer == nullptr;
-  if (new_category) {
-    // This is the minimal information that we need for now
-    catInfo.names = podio::utils::sortAlphabeticaly(collsToWrite);
+  auto& catInfo = getCategoryInfo(category, frame, collsToWrite);
+  // The collection content of an initialized category does not change anymore,
+  // so from here on everything can happen without locking
+  if (!root_utils::checkConsistentColls(catInfo.collInfo, collsToWrite)) {
+    throw std::runtime_error("Trying to write category '" + std::string(category) +
+                             "' with inconsistent collection content. " +
+                             root_utils::getInconsistentCollsMsg(catInfo.names, collsToWrite));
   }
 
-  std::vector<root_utils::StoreCollection> collections;
-  collections.reserve(catInfo.names.size());
-  // Only loop over the collections that were requested in the first Frame of
+  // Only consider the collections that were requested in the first Frame of
   // this category
-  for (const auto& name : catInfo.names) {
-    const auto* coll = frame.getCollectionForWrite(name);
-    if (!coll) {
-      // Make sure all collections that we want to write are actually available
-      // NOLINTNEXTLINE(performance-inefficient-string-concatenation)
-      throw std::runtime_error("Collection '" + name + "' in category '" + std::string(category) +
-                               "' is not available in Frame");
-    }
+  const auto collections = getCollectionsToWrite(frame, catInfo.names, category);
 
-    collections.emplace_back(name, const_cast<podio::CollectionBase*>(coll));
-  }
-
-  if (new_category) {
-    // Now we have enough info to populate the rest
-    auto model = createModels(collections);
-    catInfo.writer = root_compat::RNTupleWriter::Append(std::move(model), category, *m_file.get(), {});
-
-    catInfo.collInfo.reserve(collections.size());
-    for (const auto& [name, coll] : collections) {
-      catInfo.collInfo.emplace_back(coll->getID(), std::string(coll->getTypeName()), coll->isSubsetCollection(),
-                                    coll->getSchemaVersion(), name, root_utils::getStorageTypeName(coll));
-    }
-  } else {
-    if (!root_utils::checkConsistentColls(catInfo.collInfo, collsToWrite)) {
-      throw std::runtime_error("Trying to write category '" + std::string(category) +
-                               "' with inconsistent collection content. " +
-                               root_utils::getInconsistentCollsMsg(catInfo.names, collsToWrite));
-    }
-  }
-
-  const auto entry = catInfo.writer->GetModel().CreateBareEntry();
-
-  RNTupleWriteOptions options;
-  options.SetCompression(ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose);
+  auto* fillContext = m_options.parallelWriting ? &getFillContext(catInfo) : nullptr;
+  const auto entry = fillContext ? fillContext->GetModel().CreateBareEntry()
+                                 : catInfo.writer->GetModel().CreateBareEntry();
 
   for (const auto& [name, coll] : collections) {
     const auto collBuffers = coll->getBuffers();
@@ -148,13 +201,19 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, std::string_view categ
     // &const_cast<podio::GenericParameters&>(frame.getParameters()));
   }
 
+  // The parameters only have to be kept alive until the entry has been filled
+  ParamStorages paramStorages{};
   const auto& params = frame.getParameters();
-  fillParams<int>(params, catInfo, entry.get());
-  fillParams<float>(params, catInfo, entry.get());
-  fillParams<double>(params, catInfo, entry.get());
-  fillParams<std::string>(params, catInfo, entry.get());
+  fillParams<int>(params, paramStorages, entry.get());
+  fillParams<float>(params, paramStorages, entry.get());
+  fillParams<double>(params, paramStorages, entry.get());
+  fillParams<std::string>(params, paramStorages, entry.get());
 
-  catInfo.writer->Fill(*entry);
+  if (fillContext) {
+    fillContext->Fill(*entry);
+  } else {
+    catInfo.writer->Fill(*entry);
+  }
 }
 
 std::unique_ptr<root_compat::RNTupleModel>
@@ -224,13 +283,67 @@ RNTupleWriter::createModels(const std::vector<root_utils::StoreCollection>& coll
   return model;
 }
 
-RNTupleWriter::CategoryInfo& RNTupleWriter::getCategoryInfo(std::string_view category) {
-  if (const auto it = m_categories.find(category); it != m_categories.end()) {
-    return it->second;
+RNTupleWriter::CategoryInfo& RNTupleWriter::getCategoryInfo(std::string_view category, const podio::Frame& frame,
+                                                            const std::vector<std::string>& collsToWrite) {
+  std::lock_guard lock{*m_categoryMtx};
+  auto it = m_categories.find(category);
+  if (it == m_categories.end()) {
+    it = m_categories.emplace(category, CategoryInfo{}).first;
+  }
+  auto& catInfo = it->second;
+  // Use the writers as proxy to check whether this category has been
+  // initialized already and do so if not
+  if (catInfo.isInitialized()) {
+    return catInfo;
+  }
+
+  auto names = podio::utils::sortAlphabeticaly(collsToWrite);
+  const auto collections = getCollectionsToWrite(frame, names, category);
+  auto model = createModels(collections);
+
+  const auto options = getWriteOptions(m_options);
+  if (m_options.parallelWriting) {
+    catInfo.parallelWriter = root_compat::RNTupleParallelWriter::Append(std::move(model), category, *m_file, options);
+  } else {
+    catInfo.writer = root_compat::RNTupleWriter::Append(std::move(model), category, *m_file, options);
+  }
+
+  catInfo.names = std::move(names);
+  catInfo.collInfo.reserve(collections.size());
+  for (const auto& [name, coll] : collections) {
+    catInfo.collInfo.emplace_back(coll->getID(), std::string(coll->getTypeName()), coll->isSubsetCollection(),
+                                  coll->getSchemaVersion(), name, root_utils::getStorageTypeName(coll));
   }
 
-  const auto [it, _] = m_categories.emplace(category, CategoryInfo{});
-  return it->second;
+  return catInfo;
+}
+
+root_compat::RNTupleFillContext& RNTupleWriter::getFillContext(CategoryInfo& catInfo) {
+  std::lock_guard lock{*catInfo.contextMtx};
+  auto& fillContext = catInfo.fillContexts[std::this_thread::get_id()];
+  if (!fillContext) {
+    fillContext = catInfo.parallelWriter->CreateFillContext();
+  }
+  return *fillContext;
+}
+
+void RNTupleWriter::releaseThread() {
+  if (!m_options.parallelWriting) {
+    return;
+  }
+  // Destroying a fill context commits its remaining entries, which should not
+  // block other threads, so that only happens after all locks are released
+  std::vector<std::shared_ptr<root_compat::RNTupleFillContext>> fillContexts;
+  {
+    std::lock_guard lock{*m_categoryMtx};
+    for (auto& [_, catInfo] : m_categories) {
+      std::lock_guard contextLock{*catInfo.contextMtx};
+      if (auto it = catInfo.fillContexts.find(std::this_thread::get_id()); it != catInfo.fillContexts.end()) {
+        fillContexts.emplace_back(std::move(it->second));
+        catInfo.fillContexts.erase(it);
+      }
+    }
+  }
 }
 
 void RNTupleWriter::finish() {
@@ -279,9 +392,11 @@ void RNTupleWriter::finish() {
     m_file->Write();
 
     // All the tuple writers must be deleted before the file so that they flush
-    // unwritten output
+    // unwritten output. Fill contexts have to go before their parallel writer
     for (auto& [_, catInfo] : m_categories) {
       catInfo.writer.reset();
+      catInfo.fillContexts.clear();
+      catInfo.parallelWriter.reset();
     }
   }
 
@@ -290,6 +405,7 @@ void RNTupleWriter::finish() {
 
 std::tuple<std::vector<std::string>, std::vector<std::string>>
 RNTupleWriter::checkConsistency(const std::vector<std::string>& collsToWrite, std::string_view category) const {
+  std::lock_guard lock{*m_categoryMtx};
   if (const auto it = m_categories.find(category); it != m_categories.end()) {
     return root_utils::getInconsistentColls(it->second.names, collsToWrite);
   }
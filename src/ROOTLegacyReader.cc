@@ -122,6 +122,8 @@ void ROOTLegacyReader::openFiles(const std::vector<std::string>& filenames) {
   auto* tableBranch = root_utils::getBranch(metadatatree, "CollectionIDs");
   tableBranch->SetAddress(&table);
   tableBranch->GetEntry(0);
+  // ROOT only streams the ids and names, so the lookup indexes have to be built
+  *m_table = CollectionIDTable(m_table->ids(), m_table->names());
 
   podio::version::Version* versionPtr{nullptr};
   if (auto* versionBranch = root_utils::getBranch(metadatatree, "PodioVersion")) {
@@ -193,7 +193,10 @@ ROOTReader::CategoryInfo& ROOTReader::getCategoryInfo(std::string_view category)
   return invalidCategory;
 }
 
-void ROOTReader::initCategory(CategoryInfo& catInfo, std::string_view category) {
+void ROOTReader::readCategoryMetadata(CategoryInfo& catInfo, std::string_view category) {
+  if (catInfo.collInfo) {
+    return;
+  }
 
   auto* collInfoBranch = root_utils::getBranch(m_metaChain.get(), root_utils::collInfoName(category));
 
@@ -236,8 +239,17 @@ void ROOTReader::initCategory(CategoryInfo& catInfo, std::string_view category)
     auto* tableBranch = root_utils::getBranch(m_metaChain.get(), root_utils::idTableName(category));
     tableBranch->SetAddress(&table);
     tableBranch->GetEntry(0);
+    // ROOT only streams the ids and names, so the lookup indexes have to be built
+    *catInfo.table = podio::CollectionIDTable(catInfo.table->ids(), catInfo.table->names());
   }
 
+  catInfo.collInfo = std::make_shared<const std::vector<root_utils::CollectionWriteInfo>>(std::move(collInfo));
+}
+
+void ROOTReader::initCategory(CategoryInfo& catInfo, std::string_view category) {
+  readCategoryMetadata(catInfo, category);
+  const auto& collInfo = *catInfo.collInfo;
+
   // For backwards compatibility make it possible to read the index based files
   // from older versions
   if (m_fileVersion < podio::version::Version{0, 16, 99}) {
@@ -290,6 +302,7 @@ void ROOTReader::openFile(const std::string& filename) {
 }
 
 void ROOTReader::openFiles(const std::vector<std::string>& filenames) {
+  m_filenames = filenames;
   m_metaChain = std::make_unique<TChain>(root_utils::metaTreeName);
   // NOTE: We simply assume that the meta data doesn't change throughout the
   // chain! This essentially boils down to the assumption that all files that
@@ -325,7 +338,7 @@ void ROOTReader::openFiles(const std::vector<std::string>& filenames) {
       }
     }
 
-    m_datamodelHolder = DatamodelDefinitionHolder(std::move(datamodelDefs), std::move(edmVersions));
+    m_datamodelHolder = std::make_shared<DatamodelDefinitionHolder>(std::move(datamodelDefs), std::move(edmVersions));
   }
 
   // Do some work up front for setting up categories and setup all the chains
@@ -340,6 +353,28 @@ void ROOTReader::openFiles(const std::vector<std::string>& filenames) {
   }
 }
 
+std::unique_ptr<ROOTReader> ROOTReader::openShared() {
+  auto reader = std::make_unique<ROOTReader>();
+  reader->shareMetadata(*this);
+  reader->m_filenames = m_filenames;
+
+  // The keys of the categories have to point into the available categories of
+  // the new reader
+  for (const auto& cat : reader->m_availableCategories) {
+    auto& srcInfo = m_categories.at(cat);
+    readCategoryMetadata(srcInfo, cat);
+
+    const auto [it, _] = reader->m_categories.try_emplace(cat, std::make_unique<TChain>(cat.c_str()));
+    for (const auto& fn : m_filenames) {
+      it->second.chain->Add(fn.c_str());
+    }
+    it->second.collInfo = srcInfo.collInfo;
+    it->second.table = srcInfo.table;
+  }
+
+  return reader;
+}
+
 unsigned ROOTReader::getEntries(std::string_view name) const {
   if (const auto it = m_categories.find(name); it != m_categories.end()) {
     return it->second.chain->GetEntries();
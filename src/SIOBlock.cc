@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <dlfcn.h>
 #include <filesystem>
+#include <limits>
 #include <map>
 #include <sstream>
 
@@ -207,14 +208,63 @@ std::vector<std::string_view> SIOFileTOCRecord::getRecordNames() const {
   return cats;
 }
 
-void SIOFileTOCRecordBlock::read(sio::read_device& device, sio::version_type) {
+bool SIOFileTOCRecord::hasOnly32BitPositions() const {
+  return std::ranges::all_of(m_recordMap, [](const auto& recordList) {
+    return std::ranges::all_of(recordList.second, [](const auto pos) {
+      return pos <= std::numeric_limits<uint32_t>::max();
+    });
+  });
+}
+
+void SIOCompressedBlocksBlock::read(sio::read_device& device, sio::version_type) {
+  device.data(codec);
+  unsigned nBlocks{0};
+  device.data(nBlocks);
+  blocks.clear();
+  blocks.reserve(nBlocks);
+  for (unsigned i = 0; i < nBlocks; ++i) {
+    uint32_t uncompressedSize{0};
+    uint32_t compressedSize{0};
+    device.data(uncompressedSize);
+    device.data(compressedSize);
+    auto& block = blocks.emplace_back(CompressedBlock{uncompressedSize});
+    if (i < readMask.size() && !readMask[i]) {
+      device.seek(device.position() + compressedSize);
+      continue;
+    }
+    block.data = sio::buffer{compressedSize};
+    podio::handlePODDataSIO(device, block.data.data(), compressedSize);
+  }
+}
+
+void SIOCompressedBlocksBlock::write(sio::write_device& device) {
+  device.data(codec);
+  device.data((unsigned)blocks.size());
+  for (auto& block : blocks) {
+    const auto compressedSize = static_cast<uint32_t>(block.data.size());
+    device.data(block.uncompressedSize);
+    device.data(compressedSize);
+    podio::handlePODDataSIO(device, block.data.data(), compressedSize);
+  }
+}
+
+void SIOFileTOCRecordBlock::read(sio::read_device& device, sio::version_type version) {
   int size;
   device.data(size);
   while (size--) {
     std::string name;
     device.data(name);
     std::vector<SIOFileTOCRecord::PositionType> positions;
-    device.data(positions);
+    if (version >= sio::version::encode_version(0, 2)) {
+      unsigned nPositions{0};
+      device.data(nPositions);
+      positions.resize(nPositions);
+      podio::handlePODDataSIO(device, positions.data(), nPositions);
+    } else {
+      std::vector<uint32_t> positions32;
+      device.data(positions32);
+      positions.assign(positions32.begin(), positions32.end());
+    }
 
     record->m_recordMap.emplace_back(std::move(name), std::move(positions));
   }
@@ -224,7 +274,13 @@ void SIOFileTOCRecordBlock::write(sio::write_device& device) {
   device.data((int)record->m_recordMap.size());
   for (const auto& [name, positions] : record->m_recordMap) {
     device.data(name);
-    device.data(positions);
+    if (version() >= sio::version::encode_version(0, 2)) {
+      device.data((unsigned)positions.size());
+      podio::handlePODDataSIO(device, positions.data(), positions.size());
+    } else {
+      const std::vector<uint32_t> positions32(positions.begin(), positions.end());
+      device.data(positions32);
+    }
   }
 }
 
@@ -1,21 +1,46 @@
 #include "podio/SIOFrameData.h"
 #include "podio/SIOBlock.h"
 
-#include <sio/compression/zlib.h>
+#include "sioUtils.h"
 
 #include <algorithm>
 #include <iterator>
+#include <stdexcept>
 
 namespace podio {
 
 SIOFrameData::SIOFrameData(sio::buffer&& collBuffers, std::size_t dataSize, sio::buffer&& tableBuffer,
-                           std::size_t tableSize, std::vector<std::string> limitColls) :
+                           std::size_t tableSize, std::vector<std::string> limitColls, sio_helpers::Codec dataCodec,
+                           sio_helpers::Codec tableCodec, bool blockCompressed) :
     m_recBuffer(std::move(collBuffers)),
     m_tableBuffer(std::move(tableBuffer)),
     m_dataSize(dataSize),
     m_tableSize(tableSize),
+    m_dataCodec(dataCodec),
+    m_tableCodec(tableCodec),
+    m_blockCompressed(blockCompressed),
     m_limitColls(std::move(limitColls)) {
   readIdTable();
+  checkLimitColls();
+}
+
+SIOFrameData::SIOFrameData(std::shared_ptr<const void> mappedFile, sio::buffer_span collBuffers, std::size_t dataSize,
+                           sio::buffer_span tableBuffer, std::size_t tableSize, std::vector<std::string> limitColls,
+                           sio_helpers::Codec dataCodec, sio_helpers::Codec tableCodec, bool blockCompressed) :
+    m_mappedFile(std::move(mappedFile)),
+    m_recSpan(collBuffers),
+    m_tableSpan(tableBuffer),
+    m_dataSize(dataSize),
+    m_tableSize(tableSize),
+    m_dataCodec(dataCodec),
+    m_tableCodec(tableCodec),
+    m_blockCompressed(blockCompressed),
+    m_limitColls(std::move(limitColls)) {
+  readIdTable();
+  checkLimitColls();
+}
+
+void SIOFrameData::checkLimitColls() const {
   // Assuming here that the idTable only contains the collections that are
   // also available
   if (!m_limitColls.empty()) {
@@ -27,6 +52,14 @@ SIOFrameData::SIOFrameData(sio::buffer&& collBuffers, std::size_t dataSize, sio:
   }
 }
 
+sio::buffer_span SIOFrameData::recordSpan() const {
+  return m_mappedFile ? m_recSpan : m_recBuffer.span();
+}
+
+sio::buffer_span SIOFrameData::tableSpan() const {
+  return m_mappedFile ? m_tableSpan : m_tableBuffer.span();
+}
+
 std::optional<podio::CollectionReadBuffers> SIOFrameData::getCollectionBuffers(const std::string& name) {
   unpackBuffers();
 
@@ -43,6 +76,7 @@ std::optional<podio::CollectionReadBuffers> SIOFrameData::getCollectionBuffers(c
       return std::nullopt;
     }
 
+    readBlock(index);
     // Mark this block as consumed
     m_availableBlocks[index] = 0;
     return dynamic_cast<podio::SIOBlock*>(m_blocks[index].get())->getBuffers();
@@ -53,6 +87,9 @@ std::optional<podio::CollectionReadBuffers> SIOFrameData::getCollectionBuffers(c
 
 std::unique_ptr<podio::GenericParameters> SIOFrameData::getParameters() {
   unpackBuffers();
+  if (m_availableBlocks[0]) {
+    readBlock(0);
+  }
   m_availableBlocks[0] = 0;
   return std::make_unique<podio::GenericParameters>(std::move(m_parameters));
 }
@@ -80,26 +117,61 @@ void SIOFrameData::unpackBuffers() {
 
   createBlocks();
 
-  sio::zlib_compression compressor;
-  sio::buffer uncBuffer{m_dataSize};
-  compressor.uncompress(m_recBuffer.span(), uncBuffer);
-  sio::api::read_blocks(uncBuffer.span(), m_blocks);
-
-  if (m_limitColls.empty()) {
-    return;
-  }
-
   // In order to save on memory and to not litter the rest of the implementation
   // with similar checks, we immediately throw away all collections that should
   // not become available
-  for (size_t i = 1; i < m_blocks.size(); ++i) {
-    const auto name = m_idTable.names()[i - 1];
-    if (std::ranges::find(m_limitColls, name) == m_limitColls.end()) {
-      m_availableBlocks[i] = 0;
+  if (!m_limitColls.empty()) {
+    for (size_t i = 1; i < m_blocks.size(); ++i) {
+      const auto name = m_idTable.names()[i - 1];
+      if (std::ranges::find(m_limitColls, name) == m_limitColls.end()) {
+        m_availableBlocks[i] = 0;
+      }
+    }
+  }
+
+  if (m_blockCompressed) {
+    // Only get the compressed blocks that will become available here. They are
+    // decompressed and read on demand in readBlock
+    sio::block_list blocks;
+    auto compressedBlocks = std::make_shared<SIOCompressedBlocksBlock>();
+    compressedBlocks->readMask = m_availableBlocks;
+    blocks.emplace_back(compressedBlocks);
+    sio::api::read_blocks(recordSpan(), blocks);
+    if (compressedBlocks->blocks.size() != m_blocks.size()) {
+      throw std::runtime_error("The number of compressed blocks does not match the collection id table");
     }
+    m_blockCodec = static_cast<sio_helpers::Codec>(compressedBlocks->codec);
+    m_compressedBlocks = std::move(compressedBlocks->blocks);
+    // Everything has been copied out of the record buffer
+    m_recBuffer = sio::buffer{1};
+  } else if (m_dataCodec == sio_helpers::Codec::None) {
+    // Uncompressed records can be read directly from the mapped file
+    sio::api::read_blocks(recordSpan(), m_blocks);
+  } else {
+    sio::buffer uncBuffer{m_dataSize};
+    sio_utils::Compressor{m_dataCodec}.uncompress(recordSpan(), uncBuffer);
+    sio::api::read_blocks(uncBuffer.span(), m_blocks);
   }
 }
 
+void SIOFrameData::readBlock(size_t index) {
+  if (!m_blockCompressed) {
+    return;
+  }
+
+  auto& compressed = m_compressedBlocks[index];
+  sio::block_list blocks{m_blocks[index]};
+  if (m_blockCodec == sio_helpers::Codec::None) {
+    sio::api::read_blocks(compressed.data.span(), blocks);
+  } else {
+    sio::buffer uncBuffer{compressed.uncompressedSize};
+    sio_utils::Compressor{m_blockCodec}.uncompress(compressed.data.span(), uncBuffer);
+    sio::api::read_blocks(uncBuffer.span(), blocks);
+  }
+  // Free the compressed data, since every block is only read once
+  compressed.data = sio::buffer{1};
+}
+
 void SIOFrameData::createBlocks() {
   m_blocks.reserve(m_typeNames.size() + 1);
   // First block during writing is parameters / metadata, then collections
@@ -117,13 +189,15 @@ void SIOFrameData::createBlocks() {
 }
 
 void SIOFrameData::readIdTable() {
-  sio::buffer uncBuffer{m_tableSize};
-  sio::zlib_compression compressor;
-  compressor.uncompress(m_tableBuffer.span(), uncBuffer);
-
   sio::block_list blocks;
   blocks.emplace_back(std::make_shared<SIOCollectionIDTableBlock>());
-  sio::api::read_blocks(uncBuffer.span(), blocks);
+  if (m_tableCodec == sio_helpers::Codec::None) {
+    sio::api::read_blocks(tableSpan(), blocks);
+  } else {
+    sio::buffer uncBuffer{m_tableSize};
+    sio_utils::Compressor{m_tableCodec}.uncompress(tableSpan(), uncBuffer);
+    sio::api::read_blocks(uncBuffer.span(), blocks);
+  }
 
   auto* idTableBlock = static_cast<SIOCollectionIDTableBlock*>(blocks[0].get());
   m_idTable = idTableBlock->getTable();
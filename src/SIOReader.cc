@@ -6,11 +6,12 @@
 #include <sio/definitions.h>
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 namespace podio {
 
-SIOReader::SIOReader() {
+SIOReader::SIOReader(bool useMemoryMap) : m_useMemoryMap(useMemoryMap) {
   SIOBlockLibraryLoader::instance();
 }
 
@@ -19,6 +20,10 @@ void SIOReader::openFile(const std::string& filename) {
   if (!m_stream.is_open()) {
     throw std::runtime_error("File " + filename + " couldn't be opened");
   }
+  m_filename = filename;
+  if (m_useMemoryMap) {
+    m_mappedFile = sio_utils::MappedFile::open(filename);
+  }
 
   // NOTE: reading TOC record first because that jumps back to the start of the file!
   readFileTOCRecord();
@@ -36,6 +41,20 @@ void SIOReader::openFile(const std::string& filename) {
   readEDMDefinitions(); // Potentially could do this lazily
 }
 
+std::unique_ptr<SIOReader> SIOReader::openShared() const {
+  auto reader = std::make_unique<SIOReader>(m_useMemoryMap);
+  reader->m_stream.open(m_filename, std::ios::binary);
+  if (!reader->m_stream.is_open()) {
+    throw std::runtime_error("File " + m_filename + " couldn't be opened");
+  }
+  reader->m_filename = m_filename;
+  // The mapped file is read-only, so it can simply be shared
+  reader->m_mappedFile = m_mappedFile;
+  reader->m_tocRecord = m_tocRecord;
+  reader->shareMetadata(*this);
+  return reader;
+}
+
 std::unique_ptr<SIOFrameData> SIOReader::readNextEntry(std::string_view name,
                                                        const std::vector<std::string>& collsToRead) {
   // Skip to where the next record of this name starts in the file, based on
@@ -50,13 +69,27 @@ std::unique_ptr<SIOFrameData> SIOReader::readNextEntry(std::string_view name,
   }
   m_stream.seekg(recordPos);
 
+  if (m_mappedFile) {
+    const auto [tableSpan, tableInfo] = sio_utils::readMappedRecord(m_stream, *m_mappedFile);
+    const auto [dataSpan, dataInfo] = sio_utils::readMappedRecord(m_stream, *m_mappedFile);
+
+    m_nameCtr[nameStr]++;
+
+    return std::make_unique<SIOFrameData>(m_mappedFile, dataSpan, dataInfo._uncompressed_length, tableSpan,
+                                          tableInfo._uncompressed_length, collsToRead,
+                                          sio_utils::getCodec(dataInfo._options),
+                                          sio_utils::getCodec(tableInfo._options), sio_utils::isBlockCompressed(dataInfo));
+  }
+
   auto [tableBuffer, tableInfo] = sio_utils::readRecord(m_stream, false);
   auto [dataBuffer, dataInfo] = sio_utils::readRecord(m_stream, false);
 
   m_nameCtr[nameStr]++;
 
   return std::make_unique<SIOFrameData>(std::move(dataBuffer), dataInfo._uncompressed_length, std::move(tableBuffer),
-                                        tableInfo._uncompressed_length, collsToRead);
+                                        tableInfo._uncompressed_length, collsToRead,
+                                        sio_utils::getCodec(dataInfo._options), sio_utils::getCodec(tableInfo._options),
+                                        sio_utils::isBlockCompressed(dataInfo));
 }
 
 std::unique_ptr<SIOFrameData> SIOReader::readEntry(std::string_view name, const unsigned entry,
@@ -79,9 +112,19 @@ bool SIOReader::readFileTOCRecord() {
   m_stream.read(reinterpret_cast<char*>(&firstWords), sizeof(firstWords));
 
   const uint32_t marker = (firstWords >> 32) & 0xffffffff;
+  std::optional<sio_helpers::position_type> position;
   if (marker == sio_helpers::SIOTocMarker) {
-    const uint32_t position = firstWords & 0xffffffff;
-    m_stream.seekg(position);
+    // Files with 32 bit positions store the position next to the marker
+    position = firstWords & 0xffffffff;
+  } else if (marker == sio_helpers::SIOTocMarker64) {
+    uint64_t tocPosition{0};
+    m_stream.seekg(-sio_helpers::SIOTocInfoSize64, std::ios_base::end);
+    m_stream.read(reinterpret_cast<char*>(&tocPosition), sizeof(tocPosition));
+    position = tocPosition;
+  }
+
+  if (position) {
+    m_stream.seekg(*position);
 
     const auto& [uncBuffer, _] = sio_utils::readRecord(m_stream);
 
@@ -129,7 +172,8 @@ void SIOReader::readEDMDefinitions() {
 
   auto datamodelDefs = static_cast<SIOMapBlock<std::string, std::string>*>(blocks[0].get());
   auto edmVersions = static_cast<SIOMapBlock<std::string, podio::version::Version>*>(blocks[1].get());
-  m_datamodelHolder = DatamodelDefinitionHolder(std::move(datamodelDefs->mapData), std::move(edmVersions->mapData));
+  m_datamodelHolder =
+      std::make_shared<DatamodelDefinitionHolder>(std::move(datamodelDefs->mapData), std::move(edmVersions->mapData));
 }
 
 } // namespace podio
@@ -5,12 +5,24 @@
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 #include "sioUtils.h"
 
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace podio {
 
-SIOWriter::SIOWriter(const std::string& filename) {
+SIOWriter::SIOWriter(const std::string& filename, const WriterOptions& options) :
+    m_codec(sio_utils::getCodec(options.compression)), m_compressionLevel(options.compressionLevel.value_or(0)),
+    m_compressIndependently(options.compressCollectionsIndependently) {
+  if (options.parallelWriting) {
+    throw std::invalid_argument("Parallel writing is not supported by the SIO writer");
+  }
+  if (options.compressionLevel && (*options.compressionLevel < 1 || *options.compressionLevel > 9)) {
+    throw std::invalid_argument("Invalid compression level " + std::to_string(*options.compressionLevel) +
+                                ", has to be in [1, 9]");
+  }
+
   m_stream.open(filename, std::ios::binary);
   if (!m_stream.is_open()) {
     SIO_THROW(sio::error_code::not_open, "Couldn't open output stream '" + filename + "'");
@@ -21,7 +33,8 @@ SIOWriter::SIOWriter(const std::string& filename) {
   sio::block_list blocks;
   blocks.emplace_back(std::make_shared<SIOVersionBlock>(podio::version::build_version));
   // write the version uncompressed
-  sio_utils::writeRecord(blocks, "podio_header_info", m_stream, sizeof(podio::version::Version), false);
+  sio_utils::writeRecord(blocks, "podio_header_info", m_stream, sio_utils::Compressor{sio_helpers::Codec::None},
+                         sizeof(podio::version::Version));
 }
 
 SIOWriter::~SIOWriter() {
@@ -45,12 +58,20 @@ void SIOWriter::writeFrame(const podio::Frame& frame, std::string_view category,
   // Otherwise we cannot easily unpack the data record, because necessary
   // information is contained within the record.
   const std::string catStr(category);
+  const auto compressor = sio_utils::Compressor{m_codec, m_compressionLevel};
   sio::block_list tableBlocks;
   tableBlocks.emplace_back(sio_utils::createCollIDBlock(collections, frame.getCollectionIDTableForWrite()));
-  m_tocRecord.addRecord(catStr, sio_utils::writeRecord(tableBlocks, catStr + "_HEADER", m_stream));
+  m_tocRecord.addRecord(catStr, sio_utils::writeRecord(tableBlocks, catStr + "_HEADER", m_stream, compressor));
 
+  // If requested, compress all collections independently, such that they can
+  // also be read independently. Uncompressed records are always written as
+  // they are, such that they can be read directly from a memory mapped file
   const auto blocks = sio_utils::createBlocks(collections, frame.getParameters());
-  sio_utils::writeRecord(blocks, catStr, m_stream);
+  if (m_compressIndependently && m_codec != sio_helpers::Codec::None) {
+    sio_utils::writeBlockCompressedRecord(blocks, catStr, m_stream, compressor);
+  } else {
+    sio_utils::writeRecord(blocks, catStr, m_stream, compressor);
+  }
 }
 
 void SIOWriter::finish() {
@@ -75,18 +96,28 @@ void SIOWriter::finish() {
       std::make_shared<podio::SIOMapBlock<std::string, podio::version::Version>>(std::move(edmVersions));
   blocks.push_back(edmVersionMap);
 
-  m_tocRecord.addRecord(sio_helpers::SIOEDMDefinitionName, sio_utils::writeRecord(blocks, "EDMDefinitions", m_stream));
+  const auto compressor = sio_utils::Compressor{m_codec, m_compressionLevel};
+  m_tocRecord.addRecord(sio_helpers::SIOEDMDefinitionName,
+                        sio_utils::writeRecord(blocks, "EDMDefinitions", m_stream, compressor));
 
   blocks.clear();
   blocks.emplace_back(std::make_shared<SIOFileTOCRecordBlock>(&m_tocRecord));
 
-  auto tocStartPos = sio_utils::writeRecord(blocks, sio_helpers::SIOTocRecordName, m_stream);
+  auto tocStartPos = sio_utils::writeRecord(blocks, sio_helpers::SIOTocRecordName, m_stream, compressor);
 
   // Now that we know the position of the TOC Record, put this information
   // into a final marker that can be identified and interpreted when reading
-  // again
-  uint64_t finalWords = (((uint64_t)sio_helpers::SIOTocMarker) << 32) | ((uint64_t)tocStartPos & 0xffffffff);
-  m_stream.write(reinterpret_cast<char*>(&finalWords), sizeof(finalWords));
+  // again. Positions beyond 32 bits need a different marker with the full 64
+  // bit position in front of it, which older podio versions cannot read
+  const uint64_t tocPosition = tocStartPos;
+  if (tocPosition <= std::numeric_limits<uint32_t>::max()) {
+    const uint64_t finalWords = (((uint64_t)sio_helpers::SIOTocMarker) << 32) | (tocPosition & 0xffffffff);
+    m_stream.write(reinterpret_cast<const char*>(&finalWords), sizeof(finalWords));
+  } else {
+    const uint64_t finalWords = ((uint64_t)sio_helpers::SIOTocMarker64) << 32;
+    m_stream.write(reinterpret_cast<const char*>(&tocPosition), sizeof(tocPosition));
+    m_stream.write(reinterpret_cast<const char*>(&finalWords), sizeof(finalWords));
+  }
 
   m_stream.close();
 }
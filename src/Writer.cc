@@ -10,10 +10,23 @@
 
 #include <cstdlib>
 #include <memory>
+#include <stdexcept>
 
 namespace podio {
 
-Writer makeWriter(const std::string& filename, const std::string& type) {
+namespace {
+  /// Check that no options are requested that the ROOTWriter cannot honor
+  void checkROOTWriterOptions(const WriterOptions& options) {
+    if (options.parallelWriting) {
+      throw std::invalid_argument("Parallel writing is not supported by the ROOT (TTree) writer");
+    }
+    if (options.compression != WriterOptions::Compression::Default || options.compressionLevel) {
+      throw std::invalid_argument("Setting the compression is not supported by the ROOT (TTree) writer");
+    }
+  }
+} // namespace
+
+Writer makeWriter(const std::string& filename, const std::string& type, const WriterOptions& options) {
 
   auto endsWith = [](const std::string& str, const std::string& suffix) {
     return str.size() >= suffix.size() && 0 == str.compare(str.size() - suffix.size(), suffix.size(), suffix);
@@ -33,16 +46,17 @@ Writer makeWriter(const std::string& filename, const std::string& type) {
   }
 
   if ((type == "default" && !defaultTypeRNTuple && endsWith(filename, ".root")) || lower(type) == "root") {
+    checkROOTWriterOptions(options);
     return Writer{std::make_unique<ROOTWriter>(filename)};
   } else if ((type == "default" && defaultTypeRNTuple && endsWith(filename, ".root")) || lower(type) == "rntuple") {
 #if PODIO_ENABLE_RNTUPLE
-    return Writer{std::make_unique<RNTupleWriter>(filename)};
+    return Writer{std::make_unique<RNTupleWriter>(filename, options)};
 #else
     throw std::runtime_error("ROOT RNTuple writer not available. Please recompile with ROOT RNTuple support.");
 #endif
   } else if (endsWith(filename, ".sio")) {
 #if PODIO_ENABLE_SIO
-    return Writer{std::make_unique<SIOWriter>(filename)};
+    return Writer{std::make_unique<SIOWriter>(filename, options)};
 #else
     throw std::runtime_error("SIO writer not available. Please recompile with SIO support.");
 #endif
@@ -4,16 +4,189 @@
 #include "podio/CollectionBase.h"
 #include "podio/GenericParameters.h"
 #include "podio/SIOBlock.h"
+#include "podio/WriterOptions.h"
 
 #include <sio/api.h>
 #include <sio/compression/zlib.h>
 #include <sio/definitions.h>
 
+#if PODIO_SIO_HAS_ZSTD
+  #include <zstd.h>
+#endif
+#if PODIO_SIO_HAS_LZ4
+  #include <lz4.h>
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
 
 namespace podio {
 namespace sio_utils {
+  /// Check whether support for the codec has been built
+  constexpr bool isCodecAvailable(sio_helpers::Codec codec) {
+    switch (codec) {
+    case sio_helpers::Codec::ZLIB:
+    case sio_helpers::Codec::None:
+      return true;
+    case sio_helpers::Codec::ZSTD:
+      return PODIO_SIO_HAS_ZSTD;
+    case sio_helpers::Codec::LZ4:
+      return PODIO_SIO_HAS_LZ4;
+    }
+    return false;
+  }
+
+  /// Get the codec for the compression that has been chosen in the writer
+  /// options
+  ///
+  /// @throws std::invalid_argument if the compression is not supported by SIO
+  /// or if support for the codec has not been built
+  inline sio_helpers::Codec getCodec(WriterOptions::Compression compression) {
+    using Compression = WriterOptions::Compression;
+    auto codec = sio_helpers::Codec::ZLIB;
+    switch (compression) {
+    case Compression::Default:
+    case Compression::ZLIB:
+      break;
+    case Compression::None:
+      codec = sio_helpers::Codec::None;
+      break;
+    case Compression::ZSTD:
+      codec = sio_helpers::Codec::ZSTD;
+      break;
+    case Compression::LZ4:
+      codec = sio_helpers::Codec::LZ4;
+      break;
+    case Compression::LZMA:
+      throw std::invalid_argument("LZMA compression is not supported for SIO files");
+    }
+
+    if (!isCodecAvailable(codec)) {
+      throw std::invalid_argument("Support for the requested compression has not been built for SIO");
+    }
+    return codec;
+  }
+
+  /// Get the codec that has been used for compressing a record from its options
+  inline sio_helpers::Codec getCodec(sio::options_type options) {
+    if (!sio::api::is_compressed(options)) {
+      return sio_helpers::Codec::None;
+    }
+    return static_cast<sio_helpers::Codec>((options & sio_helpers::SIOCodecMask) >> sio_helpers::SIOCodecShift);
+  }
+
+  /// Compressor that dispatches to the codec it has been created for. It has the
+  /// same interface as the compressors that come with SIO and can hence be used
+  /// with sio::api::compress_record
+  class Compressor {
+  public:
+    /// Create a compressor for the codec with the given level. Using 0 as
+    /// level will use the default level of the codec. The level is ignored for
+    /// LZ4
+    Compressor(sio_helpers::Codec codec = sio_helpers::Codec::ZLIB, int level = 0) : m_codec(codec), m_level(level) {
+      if (!isCodecAvailable(codec)) {
+        throw std::invalid_argument("Support for codec " + std::to_string(static_cast<uint32_t>(codec)) +
+                                    " has not been built for SIO");
+      }
+    }
+
+    sio_helpers::Codec codec() const {
+      return m_codec;
+    }
+
+    /// The options that have to be set in the record header for records that
+    /// are compressed with this compressor
+    sio::options_type recordOptions() const {
+      if (m_codec == sio_helpers::Codec::None) {
+        return 0;
+      }
+      return static_cast<sio::options_type>(m_codec) << sio_helpers::SIOCodecShift;
+    }
+
+    void compress(const sio::buffer_span& inbuf, sio::buffer& outbuf) const {
+      switch (m_codec) {
+      case sio_helpers::Codec::ZLIB: {
+        sio::zlib_compression compressor;
+        compressor.set_level(m_level > 0 ? m_level : 6); // Z_DEFAULT_COMPRESSION==6
+        compressor.compress(inbuf, outbuf);
+        return;
+      }
+#if PODIO_SIO_HAS_ZSTD
+      case sio_helpers::Codec::ZSTD: {
+        outbuf.resize(ZSTD_compressBound(inbuf.size()));
+        const auto size = ZSTD_compress(outbuf.data(), outbuf.size(), inbuf.data(), inbuf.size(),
+                                        m_level > 0 ? m_level : ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(size)) {
+          SIO_THROW(sio::error_code::compress_error, std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+        }
+        outbuf.resize(size);
+        return;
+      }
+#endif
+#if PODIO_SIO_HAS_LZ4
+      case sio_helpers::Codec::LZ4: {
+        outbuf.resize(LZ4_compressBound(inbuf.size()));
+        const auto size = LZ4_compress_default(inbuf.data(), outbuf.data(), static_cast<int>(inbuf.size()),
+                                               static_cast<int>(outbuf.size()));
+        if (size <= 0) {
+          SIO_THROW(sio::error_code::compress_error, "lz4 compression failed");
+        }
+        outbuf.resize(size);
+        return;
+      }
+#endif
+      default:
+        SIO_THROW(sio::error_code::compress_error, "Cannot compress with this codec");
+      }
+    }
+
+    /// Uncompress the input buffer into the output buffer, which has to have
+    /// the uncompressed size already
+    void uncompress(const sio::buffer_span& inbuf, sio::buffer& outbuf) const {
+      switch (m_codec) {
+      case sio_helpers::Codec::ZLIB: {
+        sio::zlib_compression compressor;
+        compressor.uncompress(inbuf, outbuf);
+        return;
+      }
+#if PODIO_SIO_HAS_ZSTD
+      case sio_helpers::Codec::ZSTD: {
+        const auto size = ZSTD_decompress(outbuf.data(), outbuf.size(), inbuf.data(), inbuf.size());
+        if (ZSTD_isError(size) || size != outbuf.size()) {
+          SIO_THROW(sio::error_code::compress_error, "zstd decompression failed");
+        }
+        return;
+      }
+#endif
+#if PODIO_SIO_HAS_LZ4
+      case sio_helpers::Codec::LZ4: {
+        const auto size = LZ4_decompress_safe(inbuf.data(), outbuf.data(), static_cast<int>(inbuf.size()),
+                                              static_cast<int>(outbuf.size()));
+        if (size < 0 || static_cast<std::size_t>(size) != outbuf.size()) {
+          SIO_THROW(sio::error_code::compress_error, "lz4 decompression failed");
+        }
+        return;
+      }
+#endif
+      default:
+        SIO_THROW(sio::error_code::compress_error, "Cannot uncompress with this codec");
+      }
+    }
+
+  private:
+    sio_helpers::Codec m_codec;
+    int m_level;
+  };
+
   /// Read the record into a buffer and potentially uncompress it
   inline std::pair<sio::buffer, sio::record_info> readRecord(sio::ifstream& stream, bool decompress = true,
                                                              std::size_t initBufferSize = sio::mbyte) {
@@ -23,16 +196,83 @@ namespace sio_utils {
     sio::api::read_record_info(stream, recInfo, infoBuffer);
     sio::api::read_record_data(stream, recInfo, recBuffer);
 
-    if (decompress) {
+    const auto codec = getCodec(recInfo._options);
+    if (decompress && codec != sio_helpers::Codec::None) {
       sio::buffer uncBuffer{recInfo._uncompressed_length};
-      sio::zlib_compression compressor;
-      compressor.uncompress(recBuffer.span(), uncBuffer);
+      Compressor{codec}.uncompress(recBuffer.span(), uncBuffer);
       return std::make_pair(std::move(uncBuffer), recInfo);
     }
 
     return std::make_pair(std::move(recBuffer), recInfo);
   }
 
+  /// A read-only memory mapping of a complete file
+  class MappedFile {
+  public:
+    /// Map the file into memory
+    ///
+    /// @returns The mapped file or a nullptr if the file cannot be mapped
+    static std::shared_ptr<const MappedFile> open(const std::string& filename) {
+      const int fd = ::open(filename.c_str(), O_RDONLY);
+      if (fd < 0) {
+        return nullptr;
+      }
+      struct stat fileStat {};
+      if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ::close(fd);
+        return nullptr;
+      }
+      const auto size = static_cast<std::size_t>(fileStat.st_size);
+      void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      // The mapping stays valid after closing the file descriptor
+      ::close(fd);
+      if (data == MAP_FAILED) {
+        return nullptr;
+      }
+      return std::shared_ptr<const MappedFile>(new MappedFile(static_cast<const char*>(data), size));
+    }
+
+    ~MappedFile() {
+      ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// Get a view of size bytes starting at the given position in the file
+    sio::buffer_span span(std::size_t pos, std::size_t size) const {
+      if (pos + size > m_size) {
+        throw std::runtime_error("Trying to access data beyond the end of the mapped file");
+      }
+      return sio::buffer_span(m_data + pos, size);
+    }
+
+  private:
+    MappedFile(const char* data, std::size_t size) : m_data(data), m_size(size) {
+    }
+
+    const char* m_data;
+    std::size_t m_size;
+  };
+
+  /// Read the record at the current position of the stream as a view into the
+  /// mapped file. Only the record header is read from the stream, which is
+  /// positioned after the record afterwards
+  inline std::pair<sio::buffer_span, sio::record_info> readMappedRecord(sio::ifstream& stream,
+                                                                        const MappedFile& mappedFile) {
+    sio::record_info recInfo;
+    sio::buffer infoBuffer{sio::max_record_info_len};
+    sio::api::read_record_info(stream, recInfo, infoBuffer);
+
+    const auto dataStart = static_cast<std::size_t>(recInfo._file_start) + recInfo._header_length;
+    auto dataSpan = mappedFile.span(dataStart, recInfo._data_length);
+    stream.seekg(recInfo._file_end);
+
+    return std::make_pair(dataSpan, recInfo);
+  }
+
   using StoreCollection = std::pair<const std::string&, const podio::CollectionBase*>;
 
   /// Create the collection ID block from the passed collections
@@ -78,17 +318,18 @@ namespace sio_utils {
     return blocks;
   }
 
-  /// Write the passed record and return where it starts in the file
+  /// Write the passed record compressed with the passed compressor and return
+  /// where it starts in the file. The options are stored in the record header
+  /// in addition to the codec
   inline sio::ifstream::pos_type writeRecord(const sio::block_list& blocks, const std::string& recordName,
-                                             sio::ofstream& stream, std::size_t initBufferSize = sio::mbyte,
-                                             bool compress = true) {
+                                             sio::ofstream& stream, const Compressor& compressor = {},
+                                             std::size_t initBufferSize = sio::mbyte, sio::options_type options = 0) {
     auto buffer = sio::buffer{initBufferSize};
-    auto recInfo = sio::api::write_record(recordName, buffer, blocks, 0);
+    // The codec is stored in the record options, so that it can be picked up
+    // again when reading
+    auto recInfo = sio::api::write_record(recordName, buffer, blocks, compressor.recordOptions() | options);
 
-    if (compress) {
-      // use zlib to compress the record into another buffer
-      sio::zlib_compression compressor;
-      compressor.set_level(6); // Z_DEFAULT_COMPRESSION==6
+    if (compressor.codec() != sio_helpers::Codec::None) {
       auto comBuffer = sio::buffer{initBufferSize};
       sio::api::compress_record(recInfo, buffer, comBuffer, compressor);
 
@@ -100,6 +341,43 @@ namespace sio_utils {
     return recInfo._file_start;
   }
 
+  /// Write the passed blocks into a record in which every block is compressed
+  /// independently of the others and return where it starts in the file.
+  ///
+  /// The record itself is not compressed and contains only one
+  /// SIOCompressedBlocksBlock.
+  inline sio::ifstream::pos_type writeBlockCompressedRecord(const sio::block_list& blocks,
+                                                            const std::string& recordName, sio::ofstream& stream,
+                                                            const Compressor& compressor = {}) {
+    auto compressedBlocks = std::make_shared<SIOCompressedBlocksBlock>();
+    compressedBlocks->codec = static_cast<uint32_t>(compressor.codec());
+    compressedBlocks->blocks.reserve(blocks.size());
+
+    for (const auto& block : blocks) {
+      // Serialize every block into a record of its own. The data part of this
+      // record can be read again via sio::api::read_blocks
+      auto buffer = sio::buffer{sio::kbyte};
+      const auto recInfo = sio::api::write_record(recordName, buffer, sio::block_list{block}, 0);
+      const auto dataSpan = buffer.span(recInfo._header_length, recInfo._data_length);
+
+      auto& compressed = compressedBlocks->blocks.emplace_back(SIOCompressedBlocksBlock::CompressedBlock{
+          static_cast<uint32_t>(recInfo._data_length), sio::buffer{dataSpan.size()}});
+      if (compressor.codec() == sio_helpers::Codec::None) {
+        std::copy(dataSpan.data(), dataSpan.data() + dataSpan.size(), compressed.data.data());
+      } else {
+        compressor.compress(dataSpan, compressed.data);
+      }
+    }
+
+    return writeRecord({compressedBlocks}, recordName, stream, Compressor{sio_helpers::Codec::None}, sio::mbyte,
+                       sio_helpers::SIOBlockCompressionFlag);
+  }
+
+  /// Check whether the record has been written with writeBlockCompressedRecord
+  inline bool isBlockCompressed(const sio::record_info& recInfo) {
+    return (recInfo._options & sio_helpers::SIOBlockCompressionFlag) != 0;
+  }
+
 } // namespace sio_utils
 } // namespace podio
 
@@ -0,0 +1,232 @@
+#include "synthetic_frames.h"
+
+#include "podio/FrameCategories.h"
+#include "podio/ROOTReader.h"
+#include "podio/ROOTWriter.h"
+
+#if PODIO_ENABLE_RNTUPLE
+  #include "podio/RNTupleReader.h"
+  #include "podio/RNTupleWriter.h"
+#endif
+
+#if PODIO_ENABLE_SIO
+  #include "podio/SIOReader.h"
+  #include "podio/SIOWriter.h"
+#endif
+
+#if PODIO_ENABLE_ARROW
+  #include "podio/utilities/ArrowFrameConverter.h"
+#endif
+
+#include "TROOT.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+/// The number of frames that are written to / read from each file. Can be
+/// changed via --podio_frames=N
+int nFramesPerFile = 20;
+/// The maximum number of threads for the multi-threaded variants. Can be
+/// changed via --podio_threads=N
+int nMaxThreads = 4;
+
+/// The input files for the read benchmarks, indexed by backend and profile
+std::map<std::string, std::string> inputFiles{};
+std::mutex inputFilesMtx{};
+
+std::string makeFileName(std::string_view prefix, const FrameProfile& profile, int index, std::string_view extension) {
+  return std::string(prefix) + "_" + std::string(profile.name) + "_" + std::to_string(index) + std::string(extension);
+}
+
+template <typename WriterT>
+void writeFile(const std::string& filename, const std::vector<podio::Frame>& frames) {
+  WriterT writer(filename);
+  for (const auto& frame : frames) {
+    writer.writeFrame(frame, podio::Category::Event);
+  }
+  writer.finish();
+}
+
+/// Get the input file for the read benchmarks of a backend and profile, which
+/// is written on first use (and shared by all threads)
+template <typename WriterT>
+const std::string& inputFile(const FrameProfile& profile, std::string_view backend, std::string_view extension) {
+  std::lock_guard lock{inputFilesMtx};
+  const auto key = std::string(backend) + "/" + std::string(profile.name);
+  if (const auto it = inputFiles.find(key); it != inputFiles.end()) {
+    return it->second;
+  }
+  auto filename = makeFileName("podio_benchmark_input_" + std::string(backend), profile, 0, extension);
+  writeFile<WriterT>(filename, makeSyntheticFrames(profile, nFramesPerFile));
+  return inputFiles.emplace(key, std::move(filename)).first->second;
+}
+
+void setThroughput(benchmark::State& state, size_t nFrames, size_t nBytes) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nFrames));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * nBytes));
+  state.counters["file_size"] = benchmark::Counter(static_cast<double>(nBytes), benchmark::Counter::kAvgThreads);
+}
+
+/// Write all frames to a file in each iteration. Each thread writes its own
+/// file in the multi-threaded variants
+template <typename WriterT>
+void writeBenchmark(benchmark::State& state, const FrameProfile& profile, std::string_view backend,
+                    std::string_view extension) {
+  const auto frames = makeSyntheticFrames(profile, nFramesPerFile);
+  const auto filename =
+      makeFileName("podio_benchmark_output_" + std::string(backend), profile, state.thread_index(), extension);
+
+  for (auto _ : state) {
+    writeFile<WriterT>(filename, frames);
+  }
+
+  setThroughput(state, frames.size(), std::filesystem::file_size(filename));
+  std::filesystem::remove(filename);
+}
+
+/// Read all frames from a file and unpack all their collections in each
+/// iteration. Each thread uses its own reader in the multi-threaded variants.
+template <typename ReaderT>
+void readBenchmark(benchmark::State& state, const std::string& filename, bool parallelUnpack) {
+  size_t nFrames = 0;
+  for (auto _ : state) {
+    ReaderT reader{};
+    reader.openFile(filename);
+    nFrames = reader.getEntries(podio::Category::Event);
+    for (size_t i = 0; i < nFrames; ++i) {
+      auto frame = podio::Frame(reader.readNextEntry(podio::Category::Event));
+      frame.unpackAll(parallelUnpack);
+      benchmark::DoNotOptimize(frame);
+    }
+  }
+
+  setThroughput(state, nFrames, std::filesystem::file_size(filename));
+}
+
+template <typename WriterT, typename ReaderT>
+void registerBackend(std::string_view backend, std::string_view extension, const FrameProfile& profile) {
+  const auto suffix = std::string(backend) + "/" + std::string(profile.name);
+
+  benchmark::RegisterBenchmark(("Write/" + suffix).c_str(),
+                               [=](benchmark::State& state) {
+                                 writeBenchmark<WriterT>(state, profile, backend, extension);
+                               })
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime()
+      ->ThreadRange(1, nMaxThreads);
+
+  const auto read = [=](benchmark::State& state, bool parallelUnpack) {
+    readBenchmark<ReaderT>(state, inputFile<WriterT>(profile, backend, extension), parallelUnpack);
+  };
+  benchmark::RegisterBenchmark(("Read/" + suffix).c_str(), read, false)
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime()
+      ->ThreadRange(1, nMaxThreads);
+  benchmark::RegisterBenchmark(("ReadParallelUnpack/" + suffix).c_str(), read, true)
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+#if PODIO_ENABLE_ARROW
+void registerArrow(const FrameProfile& profile) {
+  const auto suffix = "Arrow/" + std::string(profile.name);
+
+  benchmark::RegisterBenchmark(("Write/" + suffix).c_str(),
+                               [=](benchmark::State& state) {
+                                 const auto frames = makeSyntheticFrames(profile, nFramesPerFile);
+                                 const auto collections = frames.front().getAvailableCollections();
+                                 for (auto _ : state) {
+                                   for (const auto& frame : frames) {
+                                     benchmark::DoNotOptimize(podio::convertFrameToTable(frame, collections));
+                                   }
+                                 }
+                                 state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * frames.size()));
+                               })
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime()
+      ->ThreadRange(1, nMaxThreads);
+
+  benchmark::RegisterBenchmark(("Read/" + suffix).c_str(),
+                               [=](benchmark::State& state) {
+                                 std::vector<std::shared_ptr<arrow::Table>> tables;
+                                 for (const auto& frame : makeSyntheticFrames(profile, nFramesPerFile)) {
+                                   tables.emplace_back(
+                                       podio::convertFrameToTable(frame, frame.getAvailableCollections()));
+                                 }
+                                 for (auto _ : state) {
+                                   for (const auto& table : tables) {
+                                     auto frame = podio::convertTableToFrame(table);
+                                     frame.unpackAll(false);
+                                     benchmark::DoNotOptimize(frame);
+                                   }
+                                 }
+                                 state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * tables.size()));
+                               })
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime()
+      ->ThreadRange(1, nMaxThreads);
+}
+#endif
+
+/// Parse the podio specific arguments that are left over after the benchmark
+/// library has consumed its own
+bool parseArguments(int argc, char** argv) {
+  for (int i = 1; i < argc; ++i) {
+    const auto arg = std::string_view(argv[i]);
+    if (arg.starts_with("--podio_frames=")) {
+      nFramesPerFile = std::atoi(arg.substr(15).data());
+    } else if (arg.starts_with("--podio_threads=")) {
+      nMaxThreads = std::atoi(arg.substr(16).data());
+    } else {
+      return false;
+    }
+  }
+  return nFramesPerFile > 0 && nMaxThreads > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (!parseArguments(argc, argv)) {
+    benchmark::PrintDefaultHelp();
+    std::printf("          [--podio_frames=<number of frames per file>]\n"
+                "          [--podio_threads=<maximum number of threads>]\n");
+    return 1;
+  }
+
+  for (const auto& profile : frameProfiles) {
+    registerBackend<podio::ROOTWriter, podio::ROOTReader>("ROOT", ".root", profile);
+#if PODIO_ENABLE_RNTUPLE
+    registerBackend<podio::RNTupleWriter, podio::RNTupleReader>("RNTuple", ".root", profile);
+#endif
+#if PODIO_ENABLE_SIO
+    registerBackend<podio::SIOWriter, podio::SIOReader>("SIO", ".sio", profile);
+#endif
+#if PODIO_ENABLE_ARROW
+    registerArrow(profile);
+#endif
+  }
+
+  // Readers and writers for the ROOT based backends are used from several
+  // threads in the multi-threaded variants
+  ROOT::EnableThreadSafety();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  for (const auto& [_, filename] : inputFiles) {
+    std::filesystem::remove(filename);
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef PODIO_TESTS_BENCHMARKS_SYNTHETIC_FRAMES_H // NOLINT(llvm-header-guard): folder structure not suitable
+#define PODIO_TESTS_BENCHMARKS_SYNTHETIC_FRAMES_H // NOLINT(llvm-header-guard): folder structure not suitable
+
+#include "datamodel/ExampleClusterCollection.h"
+#include "datamodel/ExampleHitCollection.h"
+#include "datamodel/ExampleWithVectorMemberCollection.h"
+
+#include "podio/Frame.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// The shape of the synthetic frames that are used for benchmarking
+struct FrameProfile {
+  std::string_view name;
+  size_t nHitCollections{0};     ///< The number of hit collections
+  size_t nHitsPerCollection{0};  ///< The number of hits in each hit collection
+  size_t nClusterLevels{0};      ///< The number of cluster collections, each referring to the previous one
+  size_t nVecCollections{0};     ///< The number of collections with vector members
+  size_t nVecsPerCollection{0};  ///< The number of elements in each of these collections
+  size_t nVecMemberEntries{0};   ///< The number of vector member entries for each element
+};
+
+/// The profiles that are available for benchmarking
+constexpr auto frameProfiles = std::array{
+    // Many small collections, as e.g. in a reconstruction output
+    FrameProfile{"ManySmall", 300, 10, 0, 0, 0, 0},
+    // A few huge collections, as e.g. raw detector hits
+    FrameProfile{"FewHuge", 2, 100'000, 0, 0, 0, 0},
+    // A deep chain of relations, where each cluster collection refers to the
+    // previous one and the first one refers to the hits
+    FrameProfile{"DeepRelations", 1, 10'000, 10, 0, 0, 0},
+    // Collections with vector members
+    FrameProfile{"VectorMembers", 0, 0, 0, 10, 1'000, 16},
+};
+
+/// Create a Frame with the shape of the passed profile. The contents only
+/// depend on the profile and on the passed index
+inline podio::Frame makeSyntheticFrame(const FrameProfile& profile, int iFrame) {
+  auto frame = podio::Frame();
+
+  const ExampleHitCollection* hits = nullptr;
+  for (size_t iColl = 0; iColl < profile.nHitCollections; ++iColl) {
+    auto coll = ExampleHitCollection();
+    for (size_t i = 0; i < profile.nHitsPerCollection; ++i) {
+      coll.create(0xcaffeeULL + i, 1.0 * i, 2.0 * i, 3.0 * iFrame, 0.5 * i);
+    }
+    hits = &frame.put(std::move(coll), "hits_" + std::to_string(iColl));
+  }
+
+  const ExampleClusterCollection* previous = nullptr;
+  for (size_t iLevel = 0; iLevel < profile.nClusterLevels; ++iLevel) {
+    auto clusters = ExampleClusterCollection();
+    const auto nClusters = hits ? hits->size() : 0;
+    for (size_t i = 0; i < nClusters; ++i) {
+      auto cluster = clusters.create(1.0 * i);
+      if (previous) {
+        cluster.addClusters((*previous)[i]);
+      } else {
+        cluster.addHits((*hits)[i]);
+      }
+    }
+    previous = &frame.put(std::move(clusters), "clusters_" + std::to_string(iLevel));
+  }
+
+  for (size_t iColl = 0; iColl < profile.nVecCollections; ++iColl) {
+    auto coll = ExampleWithVectorMemberCollection();
+    for (size_t i = 0; i < profile.nVecsPerCollection; ++i) {
+      auto vec = coll.create();
+      for (size_t j = 0; j < profile.nVecMemberEntries; ++j) {
+        vec.addcount(static_cast<int>(i + j) + iFrame);
+      }
+    }
+    frame.put(std::move(coll), "vecs_" + std::to_string(iColl));
+  }
+
+  frame.putParameter("frameIndex", iFrame);
+  return frame;
+}
+
+/// Create a number of frames with the shape of the passed profile
+inline std::vector<podio::Frame> makeSyntheticFrames(const FrameProfile& profile, int nFrames) {
+  std::vector<podio::Frame> frames;
+  frames.reserve(nFrames);
+  for (int i = 0; i < nFrames; ++i) {
+    frames.emplace_back(makeSyntheticFrame(profile, i));
+  }
+  return frames;
+}
+
+#endif // PODIO_TESTS_BENCHMARKS_SYNTHETIC_FRAMES_H
@@ -0,0 +1,97 @@
+#include "read_frame.h"
+
+#include "podio/ConcurrentReader.h"
+#include "podio/Reader.h"
+
+#include "TROOT.h"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+int main(int, char**) {
+  ROOT::EnableThreadSafety();
+
+  constexpr size_t nThreads = 4;
+  auto reader = podio::ConcurrentReader({"example_frame.root"}, nThreads);
+
+  if (reader.getEvents() != 10) {
+    std::cerr << "Could not read back the number of events correctly. (expected: " << 10
+              << ", actual: " << reader.getEvents() << ")" << std::endl;
+    return 1;
+  }
+
+  // Every thread reads a different subset of all events (and other_events)
+  std::atomic<size_t> nRead{0};
+  std::vector<std::thread> threads;
+  threads.reserve(nThreads);
+  for (size_t iThread = 0; iThread < nThreads; ++iThread) {
+    threads.emplace_back([&reader, &nRead, iThread]() {
+      for (size_t i = iThread; i < reader.getEvents(); i += nThreads) {
+        auto frame = reader.readEvent(i);
+        processEvent(frame, i, reader.currentFileVersion());
+        auto otherFrame = reader.readFrame("other_events", i);
+        processEvent(otherFrame, i + 100, reader.currentFileVersion());
+        ++nRead;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (nRead != reader.getEvents()) {
+    std::cerr << "Could not read all events (expected: " << reader.getEvents() << ", actual: " << nRead << ")"
+              << std::endl;
+    return 1;
+  }
+
+  if (reader.getNReaders() > nThreads) {
+    std::cerr << "Opened more readers than allowed (max: " << nThreads << ", actual: " << reader.getNReaders() << ")"
+              << std::endl;
+    return 1;
+  }
+
+  try {
+    [[maybe_unused]] auto frame = reader.readEvent(reader.getEvents());
+    std::cerr << "Reading beyond the available entries should throw" << std::endl;
+    return 1;
+  } catch (const std::runtime_error&) {
+  }
+
+  // Readers opened from another one share its metadata but read independently
+  auto origReader = podio::makeReader("example_frame.root");
+  auto sharedReader = origReader.openShared();
+  if (sharedReader.currentFileVersion() != origReader.currentFileVersion() ||
+      sharedReader.getAvailableCategories() != origReader.getAvailableCategories() ||
+      sharedReader.getAvailableDatamodels() != origReader.getAvailableDatamodels() ||
+      sharedReader.getEntries("other_events") != origReader.getEntries("other_events")) {
+    std::cerr << "A shared reader does not have the same metadata as the original one" << std::endl;
+    return 1;
+  }
+  for (const auto& name : origReader.getAvailableDatamodels()) {
+    if (sharedReader.getDatamodelDefinition(name) != origReader.getDatamodelDefinition(name)) {
+      std::cerr << "A shared reader does not have the same definition for datamodel " << name << std::endl;
+      return 1;
+    }
+  }
+
+  auto origFrame = origReader.readNextEvent();
+  processEvent(origFrame, 0, origReader.currentFileVersion());
+  auto sharedFrame = sharedReader.readEvent(5);
+  processEvent(sharedFrame, 5, sharedReader.currentFileVersion());
+  origFrame = origReader.readNextEvent();
+  processEvent(origFrame, 1, origReader.currentFileVersion());
+  sharedFrame = sharedReader.readNextEvent();
+  processEvent(sharedFrame, 6, sharedReader.currentFileVersion());
+
+  // A ConcurrentReader can also be created from an already opened Reader
+  auto sharedConcurrent = podio::ConcurrentReader(std::move(sharedReader), 2);
+  auto otherFrame = sharedConcurrent.readFrame("other_events", 3);
+  processEvent(otherFrame, 3 + 100, sharedConcurrent.currentFileVersion());
+
+  return 0;
+}
@@ -0,0 +1,43 @@
+#include "read_frame.h"
+
+#include "podio/PrefetchingReader.h"
+#include "podio/Reader.h"
+
+#include <iostream>
+#include <stdexcept>
+
+int main(int, char**) {
+  auto reader = podio::makeReader("example_frame.root");
+  const auto fileVersion = reader.currentFileVersion();
+
+  auto prefetchingReader = podio::PrefetchingReader(std::move(reader), podio::Category::Event, 3);
+  if (prefetchingReader.getEntries() != 10) {
+    std::cerr << "Could not read back the number of events correctly. (expected: " << 10
+              << ", actual: " << prefetchingReader.getEntries() << ")" << std::endl;
+    return 1;
+  }
+
+  // Request a few frames upfront to have more than one in flight
+  auto firstFrame = prefetchingReader.readNextFrameAsync();
+  auto secondFrame = prefetchingReader.readNextFrameAsync();
+  processEvent(firstFrame.get(), 0, fileVersion);
+  processEvent(secondFrame.get(), 1, fileVersion);
+
+  for (size_t i = 2; i < prefetchingReader.getEntries(); ++i) {
+    auto frame = prefetchingReader.readNextFrame();
+    processEvent(frame, i, fileVersion);
+  }
+
+  try {
+    [[maybe_unused]] auto frame = prefetchingReader.readNextFrame();
+    std::cerr << "Reading beyond the available entries should throw" << std::endl;
+    return 1;
+  } catch (const std::runtime_error&) {
+  }
+
+  // Destroying a reader that is still reading ahead has to work as well
+  auto earlyStopReader = podio::PrefetchingReader(podio::makeReader("example_frame.root"), podio::Category::Event, 2);
+  processEvent(earlyStopReader.readNextFrame(), 0, fileVersion);
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include "podio/RNTupleReader.h"
+#include "podio/RNTupleWriter.h"
+#include "podio/WriterOptions.h"
+
+#include "datamodel/ExampleHitCollection.h"
+
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
+#include <ROOT/RVersion.hxx>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6, 35, 0)
+using ROOT::ENTupleInfo;
+using ROOT::RNTupleWriteOptions;
+#else
+using ROOT::Experimental::ENTupleInfo;
+using ROOT::Experimental::RNTupleWriteOptions;
+#endif
+
+/// Get the compression setting of the events RNTuple in the passed file as it
+/// is reported in the storage details
+int getCompression(const std::string& filename) {
+  auto reader = podio::root_compat::RNTupleReader::Open("events", filename);
+  std::stringstream info;
+  reader->PrintInfo(ENTupleInfo::kStorageDetails, info);
+  const auto infoStr = info.str();
+  std::smatch match;
+  if (std::regex_search(infoStr, match, std::regex(R"(Compression:\s*(\d+))"))) {
+    return std::stoi(match[1]);
+  }
+  return -1;
+}
+
+int checkCompression(const std::string& filename, int expected) {
+  if (const auto compression = getCompression(filename); compression != expected) {
+    std::cerr << "Compression setting of " << filename << " is " << compression << " but should be " << expected
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int main() {
+  // Without any options the default of RNTuple has to be kept
+  const auto defaultCompression = static_cast<int>(RNTupleWriteOptions{}.GetCompression());
+  if (checkCompression("example_rntuple.root", defaultCompression)) {
+    return 1;
+  }
+
+  // Explicitly chosen algorithm and level
+  if (checkCompression("example_rntuple_options.root", 401)) {
+    return 1;
+  }
+
+  // Only setting a level keeps the default algorithm
+  {
+    podio::WriterOptions options{};
+    options.compressionLevel = 3;
+    podio::RNTupleWriter writer("example_rntuple_compression_level.root", options);
+    ExampleHitCollection hits;
+    hits.create(0xcaffeeULL, 1.0, 2.0, 3.0, 4.0);
+    podio::Frame frame{};
+    frame.put(std::move(hits), "hits");
+    writer.writeFrame(frame, "events");
+  }
+  if (checkCompression("example_rntuple_compression_level.root", (defaultCompression / 100) * 100 + 3)) {
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include "write_interface.h"
+
+#include "podio/WriterOptions.h"
+
+int main(int, char**) {
+  podio::WriterOptions options{};
+  options.compression = podio::WriterOptions::Compression::LZ4;
+  options.compressionLevel = 1;
+  options.approxZippedClusterSize = 1024 * 1024;
+  options.maxUnzippedPageSize = 64 * 1024;
+  options.useBufferedWrite = false;
+
+  auto writer = podio::makeWriter("example_rntuple_options.root", "rntuple", options);
+  write_frames(writer);
+
+  return 0;
+}
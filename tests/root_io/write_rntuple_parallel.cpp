@@ -0,0 +1,32 @@
+#include "write_frame_multithreaded.h"
+
+#include "podio/RNTupleWriter.h"
+#include "podio/Writer.h"
+
+#include "TROOT.h"
+
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char* argv[]) {
+  int nThreads = 4;
+  int framesPerThread = 10;
+  if (argc >= 2) {
+    nThreads = std::atoi(argv[1]);
+  }
+  if (argc >= 3) {
+    framesPerThread = std::atoi(argv[2]);
+  }
+
+  ROOT::EnableThreadSafety();
+
+  podio::WriterOptions options{};
+  options.parallelWriting = true;
+  // Optionally write via the generic podio::Writer instead
+  if (argc >= 4 && std::string(argv[3]) == "writer") {
+    auto writer = podio::makeWriter("example_rntuple_parallel_writer.root", "rntuple", options);
+    return write_frames_multithreaded(writer, nThreads, framesPerThread, false);
+  }
+  podio::RNTupleWriter writer("example_rntuple_parallel.root", options);
+  return write_frames_multithreaded(writer, nThreads, framesPerThread, false);
+}
@@ -0,0 +1,96 @@
+#include "podio/SIOBlock.h"
+#include "podio/SIOReader.h"
+
+#include <sio/api.h>
+#include <sio/buffer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// Check that the compressed blocks that are masked out when reading are
+/// skipped and that their data are never copied
+int checkCompressedBlocksReadMask() {
+  constexpr uint32_t blockSize = 16;
+  auto writeBlock = std::make_shared<podio::SIOCompressedBlocksBlock>();
+  for (uint32_t i = 0; i < 3; ++i) {
+    auto& block = writeBlock->blocks.emplace_back(
+        podio::SIOCompressedBlocksBlock::CompressedBlock{100 + i, sio::buffer{blockSize}});
+    std::fill(block.data.data(), block.data.data() + blockSize, static_cast<char>(i + 1));
+  }
+  sio::buffer buffer{sio::kbyte};
+  const auto recInfo = sio::api::write_record("limit_colls", buffer, sio::block_list{writeBlock}, 0);
+
+  auto readBlock = std::make_shared<podio::SIOCompressedBlocksBlock>();
+  readBlock->readMask = {1, 0, 1};
+  sio::block_list blocks{readBlock};
+  sio::api::read_blocks(buffer.span(recInfo._header_length, recInfo._data_length), blocks);
+
+  if (readBlock->blocks.size() != 3) {
+    std::cerr << "Expected 3 compressed blocks, got " << readBlock->blocks.size() << std::endl;
+    return 1;
+  }
+  for (uint32_t i = 0; i < 3; ++i) {
+    const auto& block = readBlock->blocks[i];
+    if (block.uncompressedSize != 100 + i) {
+      std::cerr << "Wrong uncompressed size for block " << i << ": " << block.uncompressedSize << std::endl;
+      return 1;
+    }
+    if (i == 1) {
+      if (block.data.size() == blockSize) {
+        std::cerr << "The data of a masked out block have been copied" << std::endl;
+        return 1;
+      }
+      continue;
+    }
+    if (block.data.size() != blockSize ||
+        !std::all_of(block.data.data(), block.data.data() + blockSize,
+                     [i](auto byte) { return byte == static_cast<char>(i + 1); })) {
+      std::cerr << "The data of block " << i << " have not been read back correctly" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/// Check that reading a Frame with a limited set of collections only makes
+/// those available
+int checkLimitedFrame(const std::string& filename) {
+  podio::SIOReader reader;
+  reader.openFile(filename);
+  auto frameData = reader.readEntry("events", 0, {"mcparticles", "info"});
+  if (!frameData) {
+    std::cerr << "Could not read the first event" << std::endl;
+    return 1;
+  }
+
+  auto available = frameData->getAvailableCollections();
+  std::ranges::sort(available);
+  if (available != std::vector<std::string>{"info", "mcparticles"}) {
+    std::cerr << "Other collections than the requested ones are available" << std::endl;
+    return 1;
+  }
+  if (!frameData->getCollectionBuffers("mcparticles")) {
+    std::cerr << "Could not get the buffers of a requested collection" << std::endl;
+    return 1;
+  }
+  if (frameData->getCollectionBuffers("hits")) {
+    std::cerr << "Could get the buffers of a collection that has not been requested" << std::endl;
+    return 1;
+  }
+  if (!frameData->getParameters()) {
+    std::cerr << "Could not get the parameters" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+int main() {
+  return checkCompressedBlocksReadMask() + checkLimitedFrame("example_frame.sio") +
+      checkLimitedFrame("example_frame_zlib_blocks.sio");
+}
@@ -0,0 +1,21 @@
+#include "read_frame.h"
+#include "read_frame_auxiliary.h"
+
+#include "podio/SIOReader.h"
+
+/// SIOReader that reads the records from a stream instead of a memory mapped
+/// file
+struct StreamSIOReader : public podio::SIOReader {
+  StreamSIOReader() : podio::SIOReader(false) {
+  }
+};
+
+int main(int argc, char* argv[]) {
+  std::string inputFile = "example_frame.sio";
+  if (argc == 2) {
+    inputFile = argv[1];
+  }
+
+  return read_frames<StreamSIOReader>(inputFile) + test_frame_aux_info<StreamSIOReader>(inputFile) +
+      test_read_frame_limited<StreamSIOReader>(inputFile);
+}
@@ -0,0 +1,29 @@
+#include "write_interface.h"
+
+#include "podio/WriterOptions.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+
+int main(int argc, char* argv[]) {
+  using Compression = podio::WriterOptions::Compression;
+  const std::map<std::string, Compression> codecs = {
+      {"none", Compression::None}, {"zlib", Compression::ZLIB}, {"zstd", Compression::ZSTD}, {"lz4", Compression::LZ4}};
+
+  // Optionally compress all collections independently
+  const bool independently = argc == 3 && std::string(argv[2]) == "blocks";
+  if (argc < 2 || argc > 3 || !codecs.contains(argv[1]) || (argc == 3 && !independently)) {
+    std::cerr << "Usage: " << argv[0] << " none|zlib|zstd|lz4 [blocks]" << std::endl;
+    return 1;
+  }
+
+  podio::WriterOptions options{};
+  options.compression = codecs.at(argv[1]);
+  options.compressCollectionsIndependently = independently;
+  const auto suffix = std::string(argv[1]) + (independently ? "_blocks" : "");
+  auto writer = podio::makeWriter("example_frame_" + suffix + ".sio", "sio", options);
+  write_frames(writer);
+
+  return 0;
+}
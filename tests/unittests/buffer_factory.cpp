@@ -1,12 +1,17 @@
 #include "datamodel/ExampleHitCollectionData.h"
 #include "podio/CollectionBufferFactory.h"
+#include "podio/CollectionPool.h"
 
 #include "datamodel/DatamodelDefinition.h"
 #include "datamodel/ExampleClusterCollection.h"
+#include "datamodel/ExampleHitCollection.h"
 #include "datamodel/ExampleWithVectorMemberCollection.h"
 
 #include "catch2/catch_test_macros.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 TEST_CASE("createBuffers", "[internals][memory-management]") {
   const auto& factory = podio::CollectionBufferFactory::instance();
 
@@ -132,3 +137,125 @@ TEST_CASE("construct CollectionData non-empty buffers", "[internals][memory-mana
     auto collData = ExampleWithVectorMemberCollectionData(std::move(buffers), false);
   }
 }
+
+TEST_CASE("Objs are created on access after reading", "[internals][memory-management]") {
+  const auto& factory = podio::CollectionBufferFactory::instance();
+  auto buffers = factory.createBuffers("ExampleHitCollection", datamodel::meta::schemaVersion, false).value();
+
+  auto dataBuffers = static_cast<ExampleHitDataContainer*>(buffers.data);
+  for (int i = 0; i < 10; ++i) {
+    dataBuffers->emplace_back(ExampleHitData{0xcaffee, 1.0, 2.0, 3.0, 10.0 * i});
+  }
+
+  SECTION("CollectionData") {
+    auto collData = ExampleHitCollectionData(std::move(buffers), false);
+    collData.prepareAfterRead(42);
+    REQUIRE(collData.entries.size() == 10);
+    REQUIRE(std::ranges::all_of(collData.entries, [](const auto* obj) { return obj == nullptr; }));
+
+    // Data can be accessed without creating the Obj
+    REQUIRE(collData.getData(5).energy == 50.0);
+    REQUIRE(collData.getData().size() == 10);
+    REQUIRE(collData.entries[5] == nullptr);
+
+    const auto* obj = collData.getObj(3);
+    REQUIRE(obj->data.energy == 30.0);
+    REQUIRE(obj->id == podio::ObjectID{3, 42});
+    REQUIRE(collData.getObj(3) == obj);
+    REQUIRE(std::ranges::count(collData.entries, nullptr) == 9);
+
+    collData.setCollectionID(43);
+    REQUIRE(obj->id == podio::ObjectID{3, 43});
+    REQUIRE(collData.getObj(7)->id == podio::ObjectID{7, 43});
+
+    collData.clear(false);
+  }
+
+  SECTION("Collection") {
+    auto coll = buffers.createCollection(std::move(buffers), false);
+    coll->prepareAfterRead();
+    const auto& hits = static_cast<const ExampleHitCollection&>(*coll);
+
+    REQUIRE(hits.size() == 10);
+    REQUIRE(hits[3].energy() == 30.0);
+    REQUIRE(hits.at(9).energy() == 90.0);
+    REQUIRE_THROWS_AS(hits.at(10), std::out_of_range);
+    size_t i = 0;
+    for (const auto hit : hits) {
+      REQUIRE(hit.energy() == 10.0 * i);
+      REQUIRE(hit.id().index == static_cast<int>(i++));
+    }
+
+    // The data buffer is kept intact, so writing doesn't need to touch it again
+    const auto* writeData = static_cast<ExampleHitDataContainer*>(coll->getBuffers().vecPtr);
+    coll->prepareForWrite();
+    REQUIRE(static_cast<ExampleHitDataContainer*>(coll->getBuffers().vecPtr) == writeData);
+    REQUIRE(writeData->size() == 10);
+    for (int j = 0; j < 10; ++j) {
+      REQUIRE((*writeData)[j].energy == 10.0 * j);
+    }
+  }
+}
+
+TEST_CASE("Recycling buffers via the CollectionPool", "[internals][memory-management]") {
+  const auto& factory = podio::CollectionBufferFactory::instance();
+
+  SECTION("Disabled by default") {
+    REQUIRE_FALSE(podio::CollectionPool::isEnabled());
+    {
+      auto hits = ExampleHitCollection();
+      hits.create();
+    }
+    REQUIRE(podio::CollectionPool::size() == 0);
+  }
+
+  podio::CollectionPool::enable();
+
+  SECTION("Buffers of read collections are recycled") {
+    const ExampleHitDataContainer* dataPtr = nullptr;
+    {
+      auto buffers = factory.createBuffers("ExampleHitCollection", datamodel::meta::schemaVersion, false).value();
+      auto dataBuffers = static_cast<ExampleHitDataContainer*>(buffers.data);
+      for (int i = 0; i < 100; ++i) {
+        dataBuffers->emplace_back(ExampleHitData{0xcaffee, 1.0, 2.0, 3.0, 1.0 * i});
+      }
+      dataPtr = dataBuffers;
+
+      auto coll = buffers.createCollection(std::move(buffers), false);
+      coll->prepareAfterRead();
+      REQUIRE(static_cast<ExampleHitDataContainer*>(coll->getBuffers().vecPtr)->capacity() >= 100);
+    }
+    REQUIRE(podio::CollectionPool::size() == 1);
+
+    auto buffers = factory.createBuffers("ExampleHitCollection", datamodel::meta::schemaVersion, false).value();
+    auto dataBuffers = static_cast<ExampleHitDataContainer*>(buffers.data);
+    REQUIRE(dataBuffers == dataPtr);
+    REQUIRE(dataBuffers->empty());
+    REQUIRE(dataBuffers->capacity() >= 100);
+    REQUIRE(podio::CollectionPool::size() == 0);
+
+    // Buffers that are not turned into a collection are recycled as well
+    buffers.deleteBuffers(buffers);
+    REQUIRE(podio::CollectionPool::size() == 1);
+  }
+
+  SECTION("Buffers of new collections are recycled") {
+    {
+      auto clusters = ExampleClusterCollection();
+      for (int i = 0; i < 10; ++i) {
+        clusters.create();
+      }
+      clusters.prepareForWrite();
+    }
+    // One data buffer and two ObjectID buffers for the relations
+    REQUIRE(podio::CollectionPool::size() == 3);
+
+    auto clusters = ExampleClusterCollection();
+    REQUIRE(podio::CollectionPool::size() == 0);
+    auto buffers = clusters.getBuffers();
+    REQUIRE(buffers.dataAsVector<ExampleClusterData>()->capacity() >= 10);
+  }
+
+  podio::CollectionPool::enable(false);
+  REQUIRE(podio::CollectionPool::size() == 0);
+}
@@ -1,11 +1,20 @@
+#include "podio/CollectionBufferFactory.h"
 #include "podio/Frame.h"
+#include "podio/MemoryResource.h"
 
 #include "catch2/catch_test_macros.hpp"
 
+#include "datamodel/DatamodelDefinition.h"
 #include "datamodel/ExampleClusterCollection.h"
 #include "datamodel/ExampleHitCollection.h"
+#include "datamodel/ExampleWithInterfaceRelationCollection.h"
+#include "datamodel/ExampleWithOneRelationCollection.h"
+#include "extension_model/ExternalRelationTypeCollection.h"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -453,3 +462,466 @@ TEST_CASE("EIC-Jana2 cleanup use case", "[memory-management][492][174]") {
   }
   delete clone;
 }
+
+namespace {
+/// Raw data for constructing a Frame from the (copied) I/O buffers of the
+/// collections of another Frame
+class CopiedFrameData {
+public:
+  CopiedFrameData(const podio::Frame& frame) : m_idTable(frame.getCollectionIDTableForWrite()) {
+  }
+  CopiedFrameData(const CopiedFrameData&) = delete;
+  CopiedFrameData& operator=(const CopiedFrameData&) = delete;
+  ~CopiedFrameData() {
+    for (auto& [_, buffers] : m_buffers) {
+      buffers.deleteBuffers(buffers);
+    }
+  }
+
+  template <typename CollT, typename DataT>
+  void addCollection(const podio::Frame& frame, const std::string& name) {
+    auto* coll = const_cast<podio::CollectionBase*>(frame.getCollectionForWrite(name));
+    const auto writeBuffers = coll->getBuffers();
+    auto readBuffers = podio::CollectionBufferFactory::instance()
+                           .createBuffers(std::string(CollT::typeName), datamodel::meta::schemaVersion,
+                                          coll->isSubsetCollection())
+                           .value();
+    if (!coll->isSubsetCollection()) {
+      *static_cast<std::vector<DataT>*>(readBuffers.data) = *static_cast<std::vector<DataT>*>(writeBuffers.vecPtr);
+    }
+    for (size_t i = 0; i < writeBuffers.references->size(); ++i) {
+      *(*readBuffers.references)[i] = *(*writeBuffers.references)[i];
+    }
+    m_buffers.emplace(name, std::move(readBuffers));
+  }
+
+  podio::CollectionIDTable getIDTable() const {
+    return {m_idTable.ids(), m_idTable.names()};
+  }
+
+  std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name) {
+    const auto it = m_buffers.find(name);
+    if (it == m_buffers.end()) {
+      return std::nullopt;
+    }
+    auto buffers = std::move(it->second);
+    m_buffers.erase(it);
+    m_unpacked.push_back(name);
+    return buffers;
+  }
+
+  /// The names of the collections that have been unpacked so far
+  const std::vector<std::string>& unpacked() const {
+    return m_unpacked;
+  }
+
+  std::vector<std::string> getAvailableCollections() const {
+    std::vector<std::string> names;
+    for (const auto& [name, _] : m_buffers) {
+      names.push_back(name);
+    }
+    return names;
+  }
+
+  std::unique_ptr<podio::GenericParameters> getParameters() {
+    return std::make_unique<podio::GenericParameters>();
+  }
+
+private:
+  podio::CollectionIDTable m_idTable{};
+  std::map<std::string, podio::CollectionReadBuffers> m_buffers{};
+  std::vector<std::string> m_unpacked{};
+};
+
+podio::Frame createReadFrame(std::pmr::memory_resource* upstream = nullptr,
+                             const CopiedFrameData** rawData = nullptr) {
+  auto frame = podio::Frame();
+  auto hits = ExampleHitCollection();
+  auto clusters = ExampleClusterCollection();
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  for (int i = 0; i < 10; ++i) {
+    auto hit = hits.create(0x42ULL, 0., 0., 0., 1.0 * i);
+    auto cluster = clusters.create(1.0 * i);
+    cluster.addHits(hit);
+    if (i % 2 == 0) {
+      hitRefs.push_back(hit);
+    }
+  }
+  frame.put(std::move(hits), "hits");
+  frame.put(std::move(clusters), "clusters");
+  frame.put(std::move(hitRefs), "hitRefs");
+
+  auto data = std::make_unique<CopiedFrameData>(frame);
+  data->addCollection<ExampleHitCollection, ExampleHitData>(frame, "hits");
+  data->addCollection<ExampleClusterCollection, ExampleClusterData>(frame, "clusters");
+  data->addCollection<ExampleHitCollection, ExampleHitData>(frame, "hitRefs");
+  if (rawData) {
+    *rawData = data.get();
+  }
+
+  if (upstream) {
+    return podio::Frame(std::move(data), upstream);
+  }
+  return podio::Frame(std::move(data));
+}
+
+void checkReadFrame(const podio::Frame& frame) {
+  const auto& hits = frame.get<ExampleHitCollection>("hits");
+  const auto& clusters = frame.get<ExampleClusterCollection>("clusters");
+  const auto& hitRefs = frame.get<ExampleHitCollection>("hitRefs");
+  REQUIRE(hits.size() == 10);
+  REQUIRE(clusters.size() == 10);
+  REQUIRE(hitRefs.size() == 5);
+  for (size_t i = 0; i < 10; ++i) {
+    REQUIRE(clusters[i].energy() == 1.0 * i);
+    REQUIRE(clusters[i].Hits_size() == 1);
+    REQUIRE(clusters[i].Hits(0) == hits[i]);
+  }
+  for (size_t i = 0; i < 5; ++i) {
+    REQUIRE(hitRefs[i] == hits[2 * i]);
+  }
+}
+} // namespace
+
+TEST_CASE("Subset collection with missing target collection", "[frame][subset-colls]") {
+  auto origFrame = podio::Frame();
+  auto hits = ExampleHitCollection();
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  for (int i = 0; i < 3; ++i) {
+    hitRefs.push_back(hits.create(0x42ULL, 0., 0., 0., 1.0 * i));
+  }
+  origFrame.put(std::move(hits), "hits");
+  origFrame.put(std::move(hitRefs), "hitRefs");
+
+  // Only the subset collection is available for reading
+  auto data = std::make_unique<CopiedFrameData>(origFrame);
+  data->addCollection<ExampleHitCollection, ExampleHitData>(origFrame, "hitRefs");
+  const auto frame = podio::Frame(std::move(data));
+
+  const auto& readRefs = frame.get<ExampleHitCollection>("hitRefs");
+  REQUIRE(readRefs.size() == 3);
+  for (size_t i = 0; i < readRefs.size(); ++i) {
+    REQUIRE_FALSE(readRefs[i].isAvailable());
+    REQUIRE_FALSE(readRefs.at(i).isAvailable());
+  }
+  size_t nHits = 0;
+  for (const auto hit : readRefs) {
+    REQUIRE_FALSE(hit.isAvailable());
+    ++nHits;
+  }
+  REQUIRE(nHits == 3);
+}
+
+TEST_CASE("Frame prefetch", "[frame][basics][multithread]") {
+  SECTION("Collections and their dependencies are unpacked") {
+    auto frame = createReadFrame();
+
+    std::atomic<int> nTasks{0};
+    frame.prefetch({"clusters", "non-existant"}, [&nTasks](const auto& tasks) {
+      for (const auto& task : tasks) {
+        ++nTasks;
+        task();
+      }
+    });
+    // One task for each requested collection, one for the hits the clusters
+    // refer to and one for setting the references of each unpacked collection
+    REQUIRE(nTasks == 2 + 1 + 2);
+
+    checkReadFrame(frame);
+  }
+
+  SECTION("Unpack all concurrently") {
+    auto frame = createReadFrame();
+    frame.unpackAll();
+    checkReadFrame(frame);
+
+    // Nothing left to do afterwards
+    size_t nTasks = 0;
+    frame.prefetch(frame.getAvailableCollections(), [&nTasks](const auto& tasks) { nTasks += tasks.size(); });
+    REQUIRE(nTasks == 0);
+  }
+
+  SECTION("Unpack all sequentially") {
+    auto frame = createReadFrame();
+    frame.unpackAll(false);
+    checkReadFrame(frame);
+  }
+
+  SECTION("Exceptions are propagated from tasks") {
+    const auto tasks = std::vector<std::function<void()>>{[]() {}, []() { throw std::runtime_error("task failed"); }};
+    REQUIRE_THROWS_AS(podio::detail::runConcurrently(tasks), std::runtime_error);
+  }
+}
+
+TEST_CASE("Frame concurrent reads of unpacked collections", "[frame][basics][multithread]") {
+  auto frame = createReadFrame();
+  // The first get happens concurrently as well to check that unpacking is
+  // still only done once
+  std::vector<std::thread> threads;
+  std::vector<const podio::CollectionBase*> hitPtrs(8, nullptr);
+  for (size_t i = 0; i < hitPtrs.size(); ++i) {
+    threads.emplace_back([&frame, &hitPtrs, i]() {
+      for (int j = 0; j < 100; ++j) {
+        const auto* hits = &frame.get<ExampleHitCollection>("hits");
+        if (j > 0 && hits != hitPtrs[i]) {
+          hitPtrs[i] = nullptr;
+          return;
+        }
+        hitPtrs[i] = hits;
+        [[maybe_unused]] const auto& clusters = frame.get<ExampleClusterCollection>("clusters");
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  REQUIRE(hitPtrs[0] != nullptr);
+  REQUIRE(std::ranges::all_of(hitPtrs, [&hitPtrs](const auto* p) { return p == hitPtrs[0]; }));
+  REQUIRE(hitPtrs[0] == frame.get("hits"));
+  checkReadFrame(frame);
+
+  // Collections that are put into the Frame are not affected
+  frame.put(ExampleHitCollection(), "moreHits");
+  REQUIRE(frame.get<ExampleHitCollection>("moreHits").empty());
+}
+
+TEST_CASE("Frame lazy relations", "[frame][relations]") {
+  SECTION("Related collections are only unpacked on first access") {
+    const CopiedFrameData* data = nullptr;
+    auto frame = createReadFrame(nullptr, &data);
+    frame.setLazyRelations();
+
+    const auto& clusters = frame.get<ExampleClusterCollection>("clusters");
+    REQUIRE(data->unpacked() == std::vector<std::string>{"clusters"});
+    // Accessing the data does not resolve any relations
+    REQUIRE(clusters[3].energy() == 3.0);
+    REQUIRE(clusters[3].Hits_size() == 1);
+    REQUIRE(data->unpacked().size() == 1);
+
+    REQUIRE(clusters[3].Hits(0).energy() == 3.0);
+    REQUIRE(data->unpacked() == std::vector<std::string>{"clusters", "hits"});
+
+    checkReadFrame(frame);
+  }
+
+  SECTION("Concurrent first access") {
+    auto frame = createReadFrame();
+    frame.setLazyRelations();
+    const auto& clusters = frame.get<ExampleClusterCollection>("clusters");
+
+    std::vector<std::thread> threads;
+    std::vector<int> nMatches(4, 0);
+    for (size_t i = 0; i < nMatches.size(); ++i) {
+      threads.emplace_back([&clusters, &nMatches, i]() {
+        for (const auto cluster : clusters) {
+          for (const auto& hit : cluster.Hits()) {
+            nMatches[i] += hit.energy() == cluster.energy();
+          }
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    REQUIRE(std::ranges::all_of(nMatches, [](const auto n) { return n == 10; }));
+    checkReadFrame(frame);
+  }
+}
+
+TEST_CASE("Relations request each referenced collection once", "[frame][relations]") {
+  auto frame = podio::Frame();
+  auto hits = ExampleHitCollection();
+  auto clusters = ExampleClusterCollection();
+  for (int i = 0; i < 10; ++i) {
+    auto cluster = clusters.create(1.0 * i);
+    for (int j = 0; j < 3; ++j) {
+      cluster.addHits(hits.create(0x42ULL, 0., 0., 0., 1.0 * j));
+    }
+  }
+  const auto& storedHits = frame.put(std::move(hits), "hits");
+  frame.put(std::move(clusters), "clusters");
+
+  CopiedFrameData data{frame};
+  data.addCollection<ExampleClusterCollection, ExampleClusterData>(frame, "clusters");
+  auto buffers = data.getCollectionBuffers("clusters").value();
+  auto readClusters = buffers.createCollection(std::move(buffers), false);
+  readClusters->prepareAfterRead();
+
+  struct CountingProvider : podio::ICollectionProvider {
+    bool get(uint32_t collectionID, podio::CollectionBase*& collection) const override {
+      ++nRequests;
+      if (collectionID != hitsID) {
+        return false;
+      }
+      collection = hits;
+      return true;
+    }
+    uint32_t hitsID{0};
+    podio::CollectionBase* hits{nullptr};
+    mutable int nRequests{0};
+  };
+  auto provider = CountingProvider{};
+  provider.hitsID = storedHits.getID();
+  provider.hits = const_cast<ExampleHitCollection*>(&storedHits);
+
+  readClusters->setReferences(&provider);
+  REQUIRE(provider.nRequests == 1);
+  const auto& typedClusters = static_cast<const ExampleClusterCollection&>(*readClusters);
+  for (size_t i = 0; i < 10; ++i) {
+    REQUIRE(typedClusters[i].Hits_size() == 3);
+    REQUIRE(typedClusters[i].Hits(2) == storedHits[3 * i + 2]);
+  }
+}
+
+TEST_CASE("Frame single relations", "[frame][relations]") {
+  auto frame = podio::Frame();
+  auto hits = ExampleHitCollection();
+  auto clusters = ExampleClusterCollection();
+  auto oneRels = ExampleWithOneRelationCollection();
+  auto ifaceRels = ExampleWithInterfaceRelationCollection();
+  for (int i = 0; i < 4; ++i) {
+    auto hit = hits.create(0x42ULL, 0., 0., 0., 1.0 * i);
+    auto cluster = clusters.create(10.0 * i);
+    auto oneRel = oneRels.create();
+    auto ifaceRel = ifaceRels.create();
+    // Leave the relations of the last objects unset
+    if (i < 3) {
+      oneRel.cluster(cluster);
+      ifaceRel.aSingleEnergyType(i % 2 == 0 ? TypeWithEnergy(hit) : TypeWithEnergy(cluster));
+    }
+  }
+  frame.put(std::move(hits), "hits");
+  frame.put(std::move(clusters), "clusters");
+  frame.put(std::move(oneRels), "oneRels");
+  frame.put(std::move(ifaceRels), "ifaceRels");
+
+  auto data = std::make_unique<CopiedFrameData>(frame);
+  data->addCollection<ExampleHitCollection, ExampleHitData>(frame, "hits");
+  data->addCollection<ExampleClusterCollection, ExampleClusterData>(frame, "clusters");
+  data->addCollection<ExampleWithOneRelationCollection, ExampleWithOneRelationData>(frame, "oneRels");
+  data->addCollection<ExampleWithInterfaceRelationCollection, ExampleWithInterfaceRelationData>(frame, "ifaceRels");
+  const auto readFrame = podio::Frame(std::move(data));
+
+  const auto& readHits = readFrame.get<ExampleHitCollection>("hits");
+  const auto& readClusters = readFrame.get<ExampleClusterCollection>("clusters");
+  const auto& readOneRels = readFrame.get<ExampleWithOneRelationCollection>("oneRels");
+  const auto& readIfaceRels = readFrame.get<ExampleWithInterfaceRelationCollection>("ifaceRels");
+  for (size_t i = 0; i < 3; ++i) {
+    REQUIRE(readOneRels[i].cluster() == readClusters[i]);
+    REQUIRE(readOneRels[i].cluster().energy() == 10.0 * i);
+    if (i % 2 == 0) {
+      REQUIRE(readIfaceRels[i].aSingleEnergyType() == TypeWithEnergy(readHits[i]));
+    } else {
+      REQUIRE(readIfaceRels[i].aSingleEnergyType() == TypeWithEnergy(readClusters[i]));
+    }
+  }
+  REQUIRE_FALSE(readOneRels[3].cluster().isAvailable());
+  REQUIRE_FALSE(readIfaceRels[3].aSingleEnergyType().isAvailable());
+  REQUIRE_FALSE(readIfaceRels[0].energyRelation().isAvailable());
+
+  // Cloning keeps the relations, and they can be changed afterwards
+  auto clone = readOneRels[1].clone();
+  REQUIRE(clone.cluster() == readClusters[1]);
+  clone.cluster(readClusters[2]);
+  REQUIRE(clone.cluster() == readClusters[2]);
+  REQUIRE(readOneRels[1].cluster() == readClusters[1]);
+  REQUIRE_FALSE(readOneRels[3].clone().cluster().isAvailable());
+}
+
+namespace {
+/// Memory resource that keeps track of the memory it hands out
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::atomic<size_t> nAllocations{0};
+  std::atomic<size_t> nDeallocations{0};
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++nAllocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+    ++nDeallocations;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+} // namespace
+
+TEST_CASE("Frame memory resource", "[frame][memory-management]") {
+  REQUIRE(podio::Frame().getMemoryResource() == nullptr);
+
+  SECTION("Unpacked collections") {
+    CountingResource upstream;
+    {
+      auto frame = createReadFrame(&upstream);
+      REQUIRE(frame.getMemoryResource() != nullptr);
+      frame.unpackAll();
+      checkReadFrame(frame);
+      REQUIRE(upstream.nAllocations > 0);
+      REQUIRE(upstream.nDeallocations == 0);
+    }
+    // Everything is released in one go when the Frame is gone
+    REQUIRE(upstream.nDeallocations == upstream.nAllocations);
+  }
+
+  SECTION("Collections created in a scope") {
+    CountingResource upstream;
+    {
+      auto frame = podio::Frame(&upstream);
+      {
+        podio::MemoryResourceScope scope{frame.getMemoryResource()};
+        REQUIRE(podio::currentMemoryResource() == frame.getMemoryResource());
+        auto hits = ExampleHitCollection();
+        for (int i = 0; i < 10; ++i) {
+          hits.create(0x42ULL, 0., 0., 0., 1.0 * i);
+        }
+        frame.put(std::move(hits), "hits");
+      }
+      REQUIRE(podio::currentMemoryResource() == nullptr);
+      REQUIRE(upstream.nAllocations > 0);
+      REQUIRE(frame.get<ExampleHitCollection>("hits")[9].energy() == 9.0);
+    }
+    REQUIRE(upstream.nDeallocations == upstream.nAllocations);
+  }
+
+  SECTION("Datamodels without useObjArena") {
+    CountingResource upstream;
+    {
+      auto frame = podio::Frame(&upstream);
+      // Without an active scope nothing is allocated from the resource
+      auto outside = extension::ExternalRelationTypeCollection();
+      outside.create(1.0f);
+      frame.put(std::move(outside), "outside");
+      REQUIRE(upstream.nAllocations == 0);
+
+      {
+        podio::MemoryResourceScope scope{frame.getMemoryResource()};
+        auto clusters = ExampleClusterCollection();
+        auto cluster = clusters.create(1.0f);
+        auto relTypes = extension::ExternalRelationTypeCollection();
+        for (int i = 0; i < 10; ++i) {
+          auto relType = relTypes.create(1.0f * i);
+          relType.addToClusters(cluster);
+          relType.addToSomeStructs(SimpleStruct{});
+        }
+        frame.put(std::move(relTypes), "relTypes");
+        frame.put(std::move(clusters), "clusters");
+      }
+      REQUIRE(upstream.nAllocations > 0);
+
+      const auto& relTypes = frame.get<extension::ExternalRelationTypeCollection>("relTypes");
+      REQUIRE(relTypes.size() == 10);
+      REQUIRE(relTypes[9].getWeight() == 9.0f);
+      REQUIRE(relTypes[3].getClusters().size() == 1);
+      REQUIRE(relTypes[3].getSomeStructs().size() == 1);
+      REQUIRE(upstream.nDeallocations == 0);
+    }
+    REQUIRE(upstream.nDeallocations == upstream.nAllocations);
+  }
+}
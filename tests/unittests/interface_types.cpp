@@ -15,6 +15,7 @@
 
 #include <map>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -166,6 +167,62 @@ TEST_CASE("InterfaceType construction and type checking", "[interface-types][bas
   }
 }
 
+TEST_CASE("InterfaceType value semantics", "[interface-types][basics]") {
+  STATIC_REQUIRE(std::is_nothrow_move_constructible_v<TypeWithEnergy>);
+  STATIC_REQUIRE(std::is_nothrow_move_assignable_v<TypeWithEnergy>);
+
+  auto hits = ExampleHitCollection();
+  hits.setID(42);
+  const auto hit = ExampleHit(hits.create(0x42ULL, 0., 0., 0., 1.5));
+  auto cluster = MutableExampleCluster();
+  cluster.energy(2.5);
+
+  auto wrapper = TypeWithEnergy(hit);
+  auto copy = wrapper;
+  REQUIRE(copy == wrapper);
+  REQUIRE(copy.getObjectID() == podio::ObjectID{0, 42});
+
+  // Assigning a different type
+  copy = TypeWithEnergy(cluster);
+  REQUIRE(copy.isA<ExampleCluster>());
+  REQUIRE(copy.energy() == 2.5);
+  REQUIRE(copy.getObjectID() == podio::ObjectID{});
+  REQUIRE(copy.isAvailable());
+  copy = wrapper;
+  REQUIRE(copy.isA<ExampleHit>());
+  REQUIRE(copy.energy() == 1.5);
+
+  // Self assignment
+  const auto& self = copy;
+  copy = self;
+  REQUIRE(copy == hit);
+
+  // Moving
+  auto moved = std::move(copy);
+  REQUIRE(moved == hit);
+  moved = TypeWithEnergy(cluster);
+  REQUIRE(moved == cluster);
+
+  auto empty = TypeWithEnergy::makeEmpty();
+  REQUIRE_FALSE(empty.isAvailable());
+  empty = std::move(moved);
+  REQUIRE(empty.isAvailable());
+  REQUIRE(empty == cluster);
+
+  // Growing a vector moves the interfaces
+  auto wrappers = std::vector<TypeWithEnergy>{};
+  for (int i = 0; i < 100; ++i) {
+    if (i % 2 == 0) {
+      wrappers.emplace_back(hit);
+    } else {
+      wrappers.emplace_back(cluster);
+    }
+  }
+  for (size_t i = 0; i < wrappers.size(); ++i) {
+    REQUIRE(wrappers[i].energy() == (i % 2 == 0 ? 1.5 : 2.5));
+  }
+}
+
 TEST_CASE("InterfaceType getters", "[basics][interface-types][code-gen]") {
   MutableExampleCluster cluster{};
   cluster.energy(3.14f);
@@ -1,6 +1,8 @@
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_vector.hpp"
 
+#include "podio/CollectionBufferFactory.h"
+#include "podio/ICollectionProvider.h"
 #include "podio/LinkCollection.h"
 #include "podio/LinkNavigator.h"
 #include "podio/utilities/TypeHelpers.h"
@@ -15,6 +17,7 @@
   #include "nlohmann/json.hpp"
 #endif
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <type_traits>
@@ -611,6 +614,85 @@ TEST_CASE("Links with interfaces", "[links][interface-types]") {
   REQUIRE(rLink.get<ExampleCluster>() == cluster);
 }
 
+TEST_CASE("LinkCollection read back", "[links][io]") {
+  auto hits = ExampleHitCollection();
+  hits.setID(42);
+  auto clusters = ExampleClusterCollection();
+  clusters.setID(43);
+  auto links = TestInterfaceLinkCollection();
+  links.setID(44);
+  for (int i = 0; i < 5; ++i) {
+    auto hit = hits.create(0x42ULL, 0., 0., 0., 1.0 * i);
+    auto cluster = clusters.create(10.0 * i);
+    auto link = links.create();
+    link.setWeight(0.5f * i);
+    link.setFrom(cluster);
+    // Alternate between the interfaced types
+    if (i % 2 == 0) {
+      link.setTo(hit);
+    } else {
+      link.setTo(cluster);
+    }
+  }
+  // One link without any endpoints
+  links.create();
+
+  links.prepareForWrite();
+  const auto writeBuffers = links.getBuffers();
+  auto readBuffers = podio::CollectionBufferFactory::instance()
+                         .createBuffers(std::string(TestInterfaceLinkCollection::typeName),
+                                        TestInterfaceLinkCollection::schemaVersion, false)
+                         .value();
+  *static_cast<std::vector<podio::LinkData>*>(readBuffers.data) =
+      *static_cast<std::vector<podio::LinkData>*>(writeBuffers.vecPtr);
+  for (size_t i = 0; i < writeBuffers.references->size(); ++i) {
+    *(*readBuffers.references)[i] = *(*writeBuffers.references)[i];
+  }
+  auto readColl = readBuffers.createCollection(std::move(readBuffers), false);
+  readColl->setID(44);
+  readColl->prepareAfterRead();
+
+  struct Provider : podio::ICollectionProvider {
+    bool get(uint32_t collectionID, podio::CollectionBase*& collection) const override {
+      if (const auto it = collections.find(collectionID); it != collections.end()) {
+        collection = it->second;
+        return true;
+      }
+      return false;
+    }
+    std::map<uint32_t, podio::CollectionBase*> collections{};
+  };
+  auto provider = Provider{};
+  provider.collections = {{42, &hits}, {43, &clusters}};
+  readColl->setReferences(&provider);
+
+  const auto& readLinks = static_cast<const TestInterfaceLinkCollection&>(*readColl);
+  REQUIRE(readLinks.size() == 6);
+  for (size_t i = 0; i < 5; ++i) {
+    REQUIRE(readLinks[i].getWeight() == 0.5f * i);
+    REQUIRE(readLinks[i].getFrom() == clusters[i]);
+    if (i % 2 == 0) {
+      REQUIRE(readLinks[i].getTo() == TypeWithEnergy(hits[i]));
+    } else {
+      REQUIRE(readLinks[i].getTo() == TypeWithEnergy(clusters[i]));
+    }
+  }
+  REQUIRE_FALSE(readLinks[5].getFrom().isAvailable());
+  REQUIRE_FALSE(readLinks[5].getTo().isAvailable());
+
+  // Writing the read collection again gives the same ObjectIDs
+  readColl->prepareForWrite();
+  const auto rewriteBuffers = readColl->getBuffers();
+  for (size_t i = 0; i < writeBuffers.references->size(); ++i) {
+    REQUIRE(*(*rewriteBuffers.references)[i] == *(*writeBuffers.references)[i]);
+  }
+
+  // Cloning keeps the endpoints
+  const auto clone = readLinks[1].clone();
+  REQUIRE(clone.getFrom() == clusters[1]);
+  REQUIRE(clone.getTo() == TypeWithEnergy(clusters[1]));
+}
+
 TEST_CASE("Links reverse iterators", "[links][iterator]") {
   const auto [linkColl, hitColl, clusterColl] = createLinkCollections();
   REQUIRE(linkColl.size() > 1);
@@ -736,6 +818,77 @@ TEST_CASE("LinkNavigator", "[links]") {
     REQUIRE_FALSE(noCluster.isAvailable());
   }
 
+  SECTION("views and batch lookups") {
+    auto hits = ExampleHitCollection();
+    auto clusters = ExampleClusterCollection();
+    for (size_t i = 0; i < 4; ++i) {
+      hits.create();
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      clusters.create();
+    }
+
+    TestLColl coll{};
+    // Links in decreasing weight to check that the order is kept
+    for (size_t i = 0; i < 6; ++i) {
+      auto link = coll.create();
+      link.setFrom(hits[i % 3]);
+      link.setTo(clusters[i % 2]);
+      link.setWeight(1.0f - i * 0.1f);
+    }
+
+    const auto nav = podio::LinkNavigator{coll};
+
+    const auto view = nav.getLinkedToView(hits[0]);
+    REQUIRE(view.size() == 2);
+    REQUIRE(view[0].o == clusters[0]);
+    REQUIRE(view[0].weight == 1.0f);
+    REQUIRE(view[1].o == clusters[1]);
+    REQUIRE(view[1].weight == 1.0f - 0.3f);
+    REQUIRE(nav.getLinkedToView(hits[3]).empty());
+
+    const auto allClusters = nav.getAllLinkedTo(hits);
+    REQUIRE(allClusters.size() == hits.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+      const auto linked = nav.getLinkedTo(hits[i]);
+      REQUIRE(std::ranges::equal(allClusters[i], linked));
+    }
+    REQUIRE(allClusters[3].empty());
+    REQUIRE(allClusters.objects.size() == coll.size());
+
+    const auto allHits = nav.getAllLinkedFrom(clusters);
+    REQUIRE(allHits.size() == clusters.size());
+    REQUIRE(allHits.offsets == std::vector<size_t>{0, 3, 6, 6});
+    using podio::detail::links::WeightedObject;
+    REQUIRE(std::ranges::equal(allHits[1], std::vector{WeightedObject{ExampleHit(hits[1]), 0.9f},
+                                                        WeightedObject{ExampleHit(hits[0]), 0.7f},
+                                                        WeightedObject{ExampleHit(hits[2]), 0.5f}}));
+  }
+
+  SECTION("interface types") {
+    auto hits = ExampleHitCollection();
+    auto clusters = ExampleClusterCollection();
+    auto hit = hits.create();
+    auto cluster = clusters.create();
+
+    auto links = TestInterfaceLinkCollection();
+    auto link = links.create();
+    link.setFrom(cluster);
+    link.setTo(hit);
+    link = links.create();
+    link.setFrom(cluster);
+    link.setTo(cluster);
+
+    const auto nav = podio::LinkNavigator{links};
+    REQUIRE(nav.getLinkedTo(cluster).size() == 2);
+    const auto linkedFromHit = nav.getLinkedFrom(hit);
+    REQUIRE(linkedFromHit.size() == 1);
+    REQUIRE(linkedFromHit[0].o == cluster);
+    const auto linkedFromCluster = nav.getLinkedFromView(TypeWithEnergy(cluster));
+    REQUIRE(linkedFromCluster.size() == 1);
+    REQUIRE(linkedFromCluster[0].o == cluster);
+  }
+
   SECTION("same types") {
     std::vector<ExampleCluster> clusters(3);
     auto linkColl = podio::LinkCollection<ExampleCluster, ExampleCluster>{};
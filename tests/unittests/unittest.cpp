@@ -1,8 +1,11 @@
 // STL
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <functional>
 #include <map>
+#include <ranges>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -23,6 +26,7 @@
 #include "podio/ROOTLegacyReader.h"
 #include "podio/ROOTReader.h"
 #include "podio/ROOTWriter.h"
+#include "podio/Writer.h"
 #include "podio/podioVersion.h"
 #include "podio/utilities/TypeHelpers.h"
 
@@ -32,9 +36,13 @@
   #define PODIO_ENABLE_SIO 0
 #endif
 #if PODIO_ENABLE_SIO
+  #include "podio/SIOBlock.h"
   #include "podio/SIOLegacyReader.h"
   #include "podio/SIOReader.h"
   #include "podio/SIOWriter.h"
+
+  #include <sio/api.h>
+  #include <sio/buffer.h>
 #endif
 
 #if PODIO_ENABLE_RNTUPLE
@@ -51,6 +59,7 @@
 #include "datamodel/ExampleWithArray.h"
 #include "datamodel/ExampleWithArrayComponent.h"
 #include "datamodel/ExampleWithComponent.h"
+#include "datamodel/ExampleWithComponentCollection.h"
 #include "datamodel/ExampleWithExternalExtraCode.h"
 #include "datamodel/ExampleWithFixedWidthIntegers.h"
 #include "datamodel/ExampleWithOneRelationCollection.h"
@@ -181,6 +190,168 @@ TEST_CASE("Container lifetime", "[basics][memory-management]") {
   REQUIRE(hit.energy() == 3.14f);
 }
 
+TEST_CASE("Arena allocated Objs", "[basics][memory-management]") {
+  // The test datamodel allocates the Objs of its collections from an arena.
+  // Mix objects that are created by the collection with ones that are adopted
+  // via push_back to make sure both are cleaned up correctly
+  auto hits = ExampleHitCollection();
+  std::vector<ExampleHit> handles;
+  for (int i = 0; i < 100; ++i) {
+    const double val = i;
+    if (i % 3 == 0) {
+      auto hit = MutableExampleHit(0x42ULL, val, val, val, val);
+      hits.push_back(hit);
+    } else {
+      hits.create(0x42ULL, val, val, val, val);
+    }
+    handles.emplace_back(hits[i]);
+  }
+
+  REQUIRE(hits.size() == 100);
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(hits[i].energy() == i);
+    REQUIRE(handles[i].energy() == i);
+    REQUIRE(hits[i].id().index == i);
+  }
+
+  handles.clear();
+  hits.clear();
+  REQUIRE(hits.empty());
+
+  // Collections can be re-filled after they have been cleared
+  for (int i = 0; i < 10; ++i) {
+    auto hit = hits.create();
+    hit.energy(2 * i);
+  }
+  REQUIRE(hits.size() == 10);
+  REQUIRE(hits[9].energy() == 18);
+
+  // Moving a collection keeps the Objs in place
+  auto movedHits = std::move(hits);
+  REQUIRE(movedHits.size() == 10);
+  REQUIRE(movedHits[5].energy() == 10);
+}
+
+TEST_CASE("Member views", "[basics][collections]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 10; ++i) {
+    hits.create(static_cast<unsigned long long>(i), 0., 1., 2., 2. * i);
+  }
+  // Views are only available once the data buffer is populated
+  REQUIRE_THROWS_AS(hits.energyView(), std::logic_error);
+
+  hits.prepareForWrite();
+  const auto energies = hits.energyView();
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(energies)>);
+  REQUIRE(energies.size() == 10);
+  REQUIRE(hits.energy() == std::vector<double>(energies.begin(), energies.end()));
+  REQUIRE(hits.cellIDView()[7] == 7);
+  REQUIRE(std::ranges::max(hits.energyView()) == 18.);
+
+  // Fields of components can be viewed as well
+  auto comps = ExampleWithComponentCollection();
+  for (int i = 0; i < 5; ++i) {
+    auto comp = comps.create();
+    comp.component().data.y = i;
+  }
+  comps.prepareForWrite();
+  const auto yValues = comps.componentView().member(&NotSoSimpleStruct::data).member(&SimpleStruct::y);
+  REQUIRE(yValues.size() == 5);
+  for (size_t i = 0; i < yValues.size(); ++i) {
+    REQUIRE(yValues[i] == static_cast<int>(i));
+  }
+
+  // Subset collections do not have any data of their own
+  auto subsetHits = ExampleHitCollection();
+  subsetHits.setSubsetCollection();
+  subsetHits.push_back(hits[0]);
+  subsetHits.prepareForWrite();
+  REQUIRE_THROWS_AS(subsetHits.xView(), std::logic_error);
+}
+
+TEST_CASE("Intrusive reference counts", "[basics][memory-management]") {
+  // The test datamodel stores the reference counts in the Objs
+  STATIC_REQUIRE(podio::utils::detail::HasIntrusiveRefCount<ExampleHitObj>);
+
+  SECTION("Handles outlive the collection") {
+    auto hit = MutableExampleHit(0x42ULL, 0., 0., 0., 1.5);
+    auto hitCopy = hit;
+    {
+      auto hits = ExampleHitCollection();
+      hits.push_back(hit);
+      REQUIRE(hits[0] == hitCopy);
+      // Putting it into a subset collection does not hand over another reference
+      auto hitRefs = ExampleHitCollection();
+      hitRefs.setSubsetCollection();
+      hitRefs.push_back(hits[0]);
+      hitRefs.push_back(ExampleHit(hit));
+    }
+    // The handles keep the Obj alive
+    REQUIRE(hit.energy() == 1.5);
+    REQUIRE(hitCopy.energy() == 1.5);
+  }
+
+  SECTION("The collection outlives the handles") {
+    auto hits = ExampleHitCollection();
+    {
+      auto hit = MutableExampleHit(0x42ULL, 0., 0., 0., 2.5);
+      hits.push_back(hit);
+      const auto hitCopy = ExampleHit(hit);
+    }
+    REQUIRE(hits[0].energy() == 2.5);
+    // Handles to objects that are owned by the collection do not count
+    // references
+    auto handles = std::vector<ExampleHit>(10, hits[0]);
+    handles.clear();
+    REQUIRE(hits[0].energy() == 2.5);
+  }
+
+  SECTION("Relations of handles that outlive the collection") {
+    auto hit = MutableExampleHit(0x42ULL, 0., 0., 0., 4.5);
+    auto cluster = MutableExampleCluster(1.0);
+    cluster.addHits(hit);
+    {
+      auto clusters = ExampleClusterCollection();
+      clusters.push_back(cluster);
+      REQUIRE(cluster.id().index == 0);
+    }
+    // The relations are handed back to the object, which is untracked again
+    REQUIRE(cluster.id() == podio::ObjectID{});
+    REQUIRE(cluster.Hits().size() == 1);
+    REQUIRE(cluster.Hits()[0].energy() == 4.5);
+
+    // and can hence be added to another collection
+    auto clusters = ExampleClusterCollection();
+    clusters.push_back(cluster);
+    REQUIRE(clusters[0].Hits().size() == 1);
+    REQUIRE(clusters[0].Hits()[0].energy() == 4.5);
+  }
+
+  SECTION("Vector members of handles that outlive the collection") {
+    auto vecMem = MutableExampleWithVectorMember();
+    vecMem.addcount(1);
+    vecMem.addcount(2);
+    {
+      auto vecMems = ExampleWithVectorMemberCollection();
+      vecMems.push_back(vecMem);
+      vecMems.clear();
+    }
+    REQUIRE(vecMem.id() == podio::ObjectID{});
+    REQUIRE(vecMem.count().size() == 2);
+    REQUIRE(vecMem.count()[1] == 2);
+  }
+
+  SECTION("Cloned objects start without references") {
+    auto hit = MutableExampleHit(0x42ULL, 0., 0., 0., 3.5);
+    auto hits = ExampleHitCollection();
+    hits.push_back(hit);
+    auto clone = hit.clone();
+    hits.push_back(clone);
+    hits.clear();
+    REQUIRE(clone.energy() == 3.5);
+  }
+}
+
 TEST_CASE("Invalid_refs", "[basics][relations]") {
   auto hits = ExampleHitCollection();
   auto hit1 = hits.create(0xcaffeeULL, 0., 0., 0., 0.);
@@ -279,6 +450,34 @@ TEST_CASE("Notebook", "[basics]") {
   REQUIRE(hits.energy().size() == hits.size());
 }
 
+TEST_CASE("CollectionIDTable lookups", "[basics][io]") {
+  auto table = podio::CollectionIDTable();
+  const auto hitsID = table.add("hits");
+  const auto clustersID = table.add("clusters");
+  REQUIRE(table.add("hits") == hitsID);
+  REQUIRE(table.names().size() == 2);
+
+  REQUIRE(table.collectionID("hits").value() == hitsID);
+  REQUIRE(table.name(clustersID).value() == "clusters");
+  REQUIRE(table.present("clusters"));
+  REQUIRE(table.present(hitsID));
+  REQUIRE_FALSE(table.present("tracks"));
+  REQUIRE_FALSE(table.name(42).has_value());
+  REQUIRE_FALSE(table.collectionID("tracks").has_value());
+
+  // Tables constructed from an existing mapping are indexed as well
+  const auto copied = podio::CollectionIDTable(table.ids(), table.names());
+  REQUIRE(copied.collectionID("clusters").value() == clustersID);
+  REQUIRE(copied.name(hitsID).value() == "hits");
+
+  // Moved-to tables keep working
+  auto moved = podio::CollectionIDTable(std::vector<uint32_t>{1, 2}, std::vector<std::string>{"a", "b"});
+  auto target = std::move(moved);
+  REQUIRE(target.collectionID("b").value() == 2);
+  REQUIRE(target.add("c") != 0);
+  REQUIRE(target.name(target.collectionID("c").value()).value() == "c");
+}
+
 TEST_CASE("OneToOneRelations", "[basics][relations]") {
   bool success = true;
   auto cluster = MutableExampleCluster();
@@ -1629,6 +1828,41 @@ TEST_CASE("ROOTWriter check consistency", "[ASAN-FAIL][UBSAN-FAIL][basics][root]
   runCheckConsistencyTest<podio::ROOTWriter>("unittests_frame_check_consistency.root");
 }
 
+TEST_CASE("makeWriter rejects unsupported options", "[basics][root]") {
+  using Compression = podio::WriterOptions::Compression;
+  const auto filename = std::string("unittests_unsupported_writer_options.root");
+
+  SECTION("Parallel writing with TTrees") {
+    podio::WriterOptions options{};
+    options.parallelWriting = true;
+    REQUIRE_THROWS_AS(podio::makeWriter(filename, "root", options), std::invalid_argument);
+  }
+
+  SECTION("Compression with TTrees") {
+    podio::WriterOptions options{};
+    options.compression = Compression::ZSTD;
+    REQUIRE_THROWS_AS(podio::makeWriter(filename, "root", options), std::invalid_argument);
+
+    options.compression = Compression::Default;
+    options.compressionLevel = 5;
+    REQUIRE_THROWS_AS(podio::makeWriter(filename, "root", options), std::invalid_argument);
+  }
+
+#if PODIO_ENABLE_SIO
+  SECTION("SIO") {
+    podio::WriterOptions options{};
+    options.parallelWriting = true;
+    REQUIRE_THROWS_AS(podio::makeWriter("unittests_unsupported_writer_options.sio", "sio", options),
+                      std::invalid_argument);
+
+    options.parallelWriting = false;
+    options.compression = Compression::LZMA;
+    REQUIRE_THROWS_AS(podio::makeWriter("unittests_unsupported_writer_options.sio", "sio", options),
+                      std::invalid_argument);
+  }
+#endif
+}
+
 TEST_CASE("checkConsistentColls detects missing collection", "[basics][root]") {
   std::vector<podio::root_utils::CollectionWriteInfo> collInfo{};
   collInfo.emplace_back(0, "T1", false, 0, "clusters", "storage");
@@ -1665,6 +1899,89 @@ TEST_CASE("Relations after cloning with SIO", "[relations][basics]") {
   runRelationAfterCloneCheck<podio::SIOReader, podio::SIOWriter>("unittests_relations_after_cloning.sio");
 }
 
+namespace {
+/// Write the TOC record into an SIO record and read it back into a new one
+podio::SIOFileTOCRecord roundTripTOCRecord(podio::SIOFileTOCRecord& tocRecord, sio::version_type expectedVersion) {
+  auto writeBlock = std::make_shared<podio::SIOFileTOCRecordBlock>(&tocRecord);
+  REQUIRE(writeBlock->version() == expectedVersion);
+  sio::buffer buffer{sio::kbyte};
+  const auto recInfo = sio::api::write_record("toc", buffer, sio::block_list{writeBlock}, 0);
+
+  podio::SIOFileTOCRecord readRecord{};
+  auto readBlock = std::make_shared<podio::SIOFileTOCRecordBlock>();
+  readBlock->record = &readRecord;
+  sio::block_list blocks{readBlock};
+  sio::api::read_blocks(buffer.span(recInfo._header_length, recInfo._data_length), blocks);
+
+  return readRecord;
+}
+} // namespace
+
+TEST_CASE("SIO TOC record positions", "[basics][sio]") {
+  using PositionType = podio::SIOFileTOCRecord::PositionType;
+  podio::SIOFileTOCRecord tocRecord{};
+
+  SECTION("Positions that fit into 32 bits use the version 0.1 layout") {
+    const std::vector<PositionType> positions = {16, 1024, 0xffffffff};
+    for (const auto pos : positions) {
+      tocRecord.addRecord("events", pos);
+    }
+    REQUIRE(tocRecord.hasOnly32BitPositions());
+
+    const auto readRecord = roundTripTOCRecord(tocRecord, sio::version::encode_version(0, 1));
+    REQUIRE(readRecord.getNRecords("events") == positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      REQUIRE(readRecord.getPosition("events", i) == positions[i]);
+    }
+  }
+
+  SECTION("Positions beyond 4 GiB use the version 0.2 layout") {
+    const std::vector<PositionType> positions = {16, 0x100000000, 0x123456789abc};
+    tocRecord.addRecord("runs", 42);
+    for (const auto pos : positions) {
+      tocRecord.addRecord("events", pos);
+    }
+    REQUIRE_FALSE(tocRecord.hasOnly32BitPositions());
+
+    const auto readRecord = roundTripTOCRecord(tocRecord, sio::version::encode_version(0, 2));
+    REQUIRE(readRecord.getNRecords("runs") == 1);
+    REQUIRE(readRecord.getPosition("runs") == 42);
+    REQUIRE(readRecord.getNRecords("events") == positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      REQUIRE(readRecord.getPosition("events", i) == positions[i]);
+    }
+  }
+}
+
+TEST_CASE("SIO files with a version 0.1 TOC", "[basics][sio]") {
+  const auto filename = std::string("unittests_sio_toc_v01.sio");
+  {
+    auto writer = podio::SIOWriter(filename);
+    for (int i = 0; i < 3; ++i) {
+      auto frame = podio::Frame();
+      frame.putParameter("index", i);
+      writer.writeFrame(frame, podio::Category::Event);
+    }
+    writer.finish();
+  }
+
+  // Small files end with the 32 bit TOC position and the marker that is
+  // understood by older podio versions
+  std::ifstream file(filename, std::ios::binary);
+  file.seekg(-podio::sio_helpers::SIOTocInfoSize, std::ios::end);
+  uint64_t finalWords{0};
+  file.read(reinterpret_cast<char*>(&finalWords), sizeof(finalWords));
+  REQUIRE(((finalWords >> 32) & 0xffffffff) == podio::sio_helpers::SIOTocMarker);
+
+  auto reader = podio::SIOReader();
+  reader.openFile(filename);
+  REQUIRE(reader.getEntries(podio::Category::Event) == 3);
+  for (int i = 0; i < 3; ++i) {
+    const auto frame = podio::Frame(reader.readEntry(podio::Category::Event, i));
+    REQUIRE(frame.getParameter<int>("index").value() == i);
+  }
+}
+
 #endif
 
 TEST_CASE("Clone empty relations", "[relations][basics]") {
@@ -76,9 +76,10 @@ podio::Frame createRandomFrame(int frameId) {
   return frame;
 }
 
+/// Write frames from several threads into the passed writer. If lockWriter is
+/// false, the writer has to support concurrent calls to writeFrame
 template <typename WriterT>
-int write_frames_multithreaded(const std::string& filename, int nThreads, int framesPerThread) {
-  WriterT writer(filename);
+int write_frames_multithreaded(WriterT& writer, int nThreads, int framesPerThread, bool lockWriter = true) {
   std::mutex writerMutex;
   std::atomic<int> frameCounter{0};
   {
@@ -89,9 +90,16 @@ int write_frames_multithreaded(const std::string& filename, int nThreads, int fr
           const int frameId = frameCounter.fetch_add(1);
           auto frame = createRandomFrame(frameId);
 
-          {
+          if (lockWriter) {
             std::lock_guard<std::mutex> lock(writerMutex);
             writer.writeFrame(frame, "events");
+          } else {
+            writer.writeFrame(frame, "events");
+          }
+        }
+        if constexpr (requires { writer.releaseThread(); }) {
+          if (!lockWriter) {
+            writer.releaseThread();
           }
         }
       });
@@ -102,4 +110,10 @@ int write_frames_multithreaded(const std::string& filename, int nThreads, int fr
   return 0;
 }
 
+template <typename WriterT>
+int write_frames_multithreaded(const std::string& filename, int nThreads, int framesPerThread) {
+  WriterT writer(filename);
+  return write_frames_multithreaded(writer, nThreads, framesPerThread);
+}
+
 #endif // PODIO_TESTS_WRITE_FRAME_MULTITHREADED_H